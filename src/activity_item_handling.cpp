@@ -6,6 +6,7 @@
 #include <cstdlib>
 #include <iosfwd>
 #include <list>
+#include <map>
 #include <memory>
 #include <optional>
 #include <set>
@@ -1939,6 +1940,21 @@ static bool chop_plank_activity( Character &you, const tripoint_bub_ms &src_loc
     return false;
 }
 
+// Zones around the character sorting loot, indexed when sorting started or when the character
+// got out of reach of the previous index.
+static shared_ptr_fast<const loot_zone_index> loot_sort_plan( player_activity &act,
+        Character &you, bool restart )
+{
+    const zone_manager &mgr = zone_manager::get_manager();
+    const tripoint_abs_ms abspos = you.get_location();
+    const faction_id fac = _fac_id( you );
+    if( restart || !act.loot_zones || !act.loot_zones->covers( mgr, abspos, fac ) ) {
+        act.loot_zones = make_shared_fast<const loot_zone_index>( mgr, abspos,
+                         ACTIVITY_SEARCH_DISTANCE, fac );
+    }
+    return act.loot_zones;
+}
+
 void activity_on_turn_move_loot( player_activity &act, Character &you )
 {
     enum activity_stage : int {
@@ -1966,12 +1982,15 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
         mgr.cache_vzones();
     }
 
+    // Kept here, the activity may be replaced while sorting
+    const shared_ptr_fast<const loot_zone_index> plan_ptr = loot_sort_plan( act, you,
+            stage == INIT );
+    const loot_zone_index &plan = *plan_ptr;
     if( stage == INIT ) {
         // TODO: fix point types
         act.coord_set.clear();
         for( const tripoint_abs_ms &p :
-             mgr.get_near( zone_type_LOOT_UNSORTED, abspos, ACTIVITY_SEARCH_DISTANCE, nullptr,
-                           _fac_id( you ) ) ) {
+             plan.get_near( zone_type_LOOT_UNSORTED, abspos, ACTIVITY_SEARCH_DISTANCE, nullptr ) ) {
             act.coord_set.insert( p.raw() );
         }
         stage = THINK;
@@ -2021,7 +2040,7 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             // skip tiles in IGNORE zone and tiles on fire
             // (to prevent taking out wood off the lit brazier)
             // and inaccessible furniture, like filled charcoal kiln
-            if( mgr.has( zone_type_LOOT_IGNORE, src, _fac_id( you ) ) ||
+            if( plan.has( zone_type_LOOT_IGNORE, src ) ||
                 here.get_field( src_loc, fd_fire ) != nullptr ||
                 !here.can_put_items_ter_furn( src_loc ) ) {
                 continue;
@@ -2141,7 +2160,7 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             }
 
             // skip favorite items in ignore favorite zones
-            if( thisitem.is_favorite && mgr.has( zone_type_LOOT_IGNORE_FAVORITES, src, _fac_id( you ) ) ) {
+            if( thisitem.is_favorite && plan.has( zone_type_LOOT_IGNORE_FAVORITES, src ) ) {
                 continue;
             }
 
@@ -2149,23 +2168,24 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             vehicle *this_veh = it->second ? src_veh : nullptr;
             const int this_part = it->second ? src_part : -1;
 
-            const zone_type_id id = mgr.get_near_zone_type_for_item( thisitem, abspos,
-                                    ACTIVITY_SEARCH_DISTANCE, _fac_id( you ) );
+            const zone_type_id id = plan.get_near_zone_type_for_item( thisitem, abspos,
+                                    ACTIVITY_SEARCH_DISTANCE );
 
             // checks whether the item is already on correct loot zone or not
             // if it is, we can skip such item, if not we move the item to correct pile
             // think empty bag on food pile, after you ate the content
-            if( id != zone_type_LOOT_CUSTOM && mgr.has( id, src, _fac_id( you ) ) ) {
+            if( id != zone_type_LOOT_CUSTOM && plan.has( id, src ) ) {
                 continue;
             }
 
             if( id == zone_type_LOOT_CUSTOM &&
-                mgr.custom_loot_has( src, &thisitem, zone_type_LOOT_CUSTOM, _fac_id( you ) ) ) {
+                plan.custom_loot_has( src, thisitem, zone_type_LOOT_CUSTOM ) ) {
                 continue;
             }
 
-            const std::unordered_set<tripoint_abs_ms> dest_set =
-                mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, &thisitem, _fac_id( you ) );
+            // nearest destinations first
+            const std::vector<tripoint_abs_ms> dest_set =
+                plan.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, &thisitem );
 
             // if this item isn't going anywhere and its not sealed
             // check if it is in a unload zone or a strip corpse zone
@@ -2173,8 +2193,8 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             bool move_and_reset = false;
             bool moved_something = false;
 
-            if( mgr.has_near( zone_type_zone_unload_all, abspos, 1, _fac_id( you ) ) ||
-                ( mgr.has_near( zone_type_zone_strip, abspos, 1, _fac_id( you ) ) && it->first->is_corpse() ) ) {
+            if( plan.has_near( zone_type_zone_unload_all, abspos, 1 ) ||
+                ( plan.has_near( zone_type_zone_strip, abspos, 1 ) && it->first->is_corpse() ) ) {
                 if( dest_set.empty() || unload_always ) {
                     if( you.rate_action_unload( *it->first ) == hint_rating::good &&
                         !it->first->any_pockets_sealed() ) {
@@ -2307,6 +2327,7 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
     }
 
     // If we got here without restarting the activity, it means we're done
+    act.loot_zones.reset();
     add_msg( m_info, _( "%s sorted out every item possible." ), you.disp_name( false, true ) );
     if( you.is_npc() ) {
         npc *guy = dynamic_cast<npc *>( &you );
@@ -3014,6 +3035,9 @@ bool generic_multi_activity_handler( player_activity &act, Character &you, bool
     if( activity_to_restore == activity_id( ACT_FETCH_REQUIRED ) && src_sorted.empty() ) {
         return true;
     }
+    // Judging each spot asks about the same tools again, nothing carried changes until the
+    // activity is done at one of them.
+    std::optional<Character::item_index_scope> item_scope( std::in_place, you );
     for( const tripoint_abs_ms &src : src_sorted ) {
         const tripoint_bub_ms &src_loc = here.bub_from_abs( src );
         if( !here.inbounds( src_loc ) && !check_only ) {
@@ -3093,12 +3117,14 @@ bool generic_multi_activity_handler( player_activity &act, Character &you, bool
             return false;
         }
         if( !check_only ) {
+            item_scope.reset();
             if( !generic_multi_activity_do( you, activity_to_restore, act_info, src, src_loc ) ) {
                 // if the activity was successful
                 // then a new activity was assigned
                 // and the backlog was given the multi-act
                 return false;
             }
+            item_scope.emplace( you );
         } else {
             return true;
         }
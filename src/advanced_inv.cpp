@@ -697,6 +697,8 @@ void advanced_inventory::recalc_pane( side p )
     advanced_inventory_pane &pane = panes[p];
     pane.recalc = false;
     pane.items.clear();
+    // Items are only moved or changed by actions that ask for this
+    item::invalidate_display_cache();
     advanced_inventory_pane &there = panes[-p + 1];
     advanced_inv_area &other = squares[there.get_area()];
     avatar &player_character = get_avatar();
@@ -1514,6 +1516,8 @@ void advanced_inventory::display()
 {
     avatar &player_character = get_avatar();
     input_context ctxt{ register_ctxt() };
+    // Names of all listed items are drawn on every redraw
+    item::display_cache_scope display_cache_scope;
 
     exit = false;
     if( !is_processing() ) {
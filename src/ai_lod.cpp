@@ -0,0 +1,47 @@
+#include "ai_lod.h"
+
+#include <algorithm>
+#include <climits>
+#include <utility>
+
+#include "game_constants.h"
+#include "line.h"
+#include "monster.h"
+#include "mtype.h"
+#include "point.h"
+
+namespace ai_lod
+{
+
+int interval( const int dist, const int sight_range, const int max_interval )
+{
+    // A monster acting on banked moves may cover several tiles at once, stay out of sight range
+    // by more than that.
+    const int safe_dist = sight_range + 2 * SEEX;
+    if( max_interval <= 1 || dist <= safe_dist ) {
+        return 1;
+    }
+    return std::min( max_interval, 2 + ( dist - safe_dist ) / SEEX );
+}
+
+bool should_act( monster &critter, const std::vector<tripoint> &watchers, const int max_interval )
+{
+    const bool stimulus = std::exchange( critter.ai_lod_stimulus, false );
+    if( max_interval <= 1 || stimulus || critter.friendly != 0 || critter.wandf > 0 ||
+        critter.turns_since_target < idle_turns ) {
+        critter.ai_lod_skipped = 0;
+        return true;
+    }
+    int dist = INT_MAX;
+    for( const tripoint &p : watchers ) {
+        dist = std::min( dist, rl_dist( critter.pos(), p ) );
+    }
+    const int turns = interval( dist, critter.type->plan_profile.max_sight_range, max_interval );
+    if( ++critter.ai_lod_skipped < turns ) {
+        return false;
+    }
+    critter.ai_lod_skipped = 0;
+    return true;
+}
+
+} // namespace ai_lod
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef CATA_SRC_AI_LOD_H
+#define CATA_SRC_AI_LOD_H
+
+#include <vector>
+
+class monster;
+struct tripoint;
+
+/**
+ * Level of detail for monster AI. Monsters that have nothing to do and are far from the player
+ * and NPCs only plan and move every few turns. Their movement points are kept in the meantime,
+ * so they end up covering the same distance, in fewer and larger steps.
+ */
+namespace ai_lod
+{
+
+/** Turns without a target after which a monster counts as idle. */
+constexpr int idle_turns = 10;
+
+/**
+ * How many turns apart a monster plans when the nearest creature it could see or hunt is dist
+ * tiles away, 1 meaning every turn. It is always 1 where the monster could see that creature
+ * within max_interval turns.
+ */
+int interval( int dist, int sight_range, int max_interval );
+
+/**
+ * To be called once per turn for every monster, after it got its moves for the turn.
+ * @param watchers Positions of the player and the NPCs.
+ * @param max_interval Longest allowed @ref interval, 1 disables skipping.
+ * @returns Whether the monster should plan and move this turn.
+ */
+bool should_act( monster &critter, const std::vector<tripoint> &watchers, int max_interval );
+
+} // namespace ai_lod
+
+#endif // CATA_SRC_AI_LOD_H
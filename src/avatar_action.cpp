@@ -27,6 +27,7 @@
 #include "game.h"
 #include "game_constants.h"
 #include "game_inventory.h"
+#include "interned_flag.h"
 #include "inventory.h"
 #include "item.h"
 #include "item_location.h"
@@ -70,6 +71,8 @@ static const efftype_id effect_ridden( "ridden" );
 static const efftype_id effect_stunned( "stunned" );
 static const efftype_id effect_winded( "winded" );
 
+static const interned_flag flag_BRIDGE( "BRIDGE" );
+
 static const itype_id itype_swim_fins( "swim_fins" );
 
 static const move_mode_id move_mode_prone( "prone" );
@@ -424,9 +427,9 @@ bool avatar_action::move( avatar &you, map &m, const tripoint &d )
         }
     }
     bool toSwimmable = m.has_flag( ter_furn_flag::TFLAG_SWIMMABLE, dest_loc ) &&
-                       !m.has_flag_furn( "BRIDGE", dest_loc );
+                       !m.has_flag_furn( flag_BRIDGE, dest_loc );
     bool toDeepWater = m.has_flag( ter_furn_flag::TFLAG_DEEP_WATER, dest_loc ) &&
-                       !m.has_flag_furn( "BRIDGE", dest_loc );
+                       !m.has_flag_furn( flag_BRIDGE, dest_loc );
     bool fromSwimmable = m.has_flag( ter_furn_flag::TFLAG_SWIMMABLE, you.pos() );
     bool fromDeepWater = m.has_flag( ter_furn_flag::TFLAG_DEEP_WATER, you.pos() );
     bool fromBoat = veh0 != nullptr;
@@ -28,6 +28,7 @@
 #include "path_info.h"
 #include "pinyin.h"
 #include "rng.h"
+#include "save_writer.h"
 #include "translations.h"
 #include "unicode.h"
 #include "zlib.h"
@@ -468,6 +469,8 @@ std::unique_ptr<std::istream> read_maybe_compressed_file( const std::string &pat
 
 std::unique_ptr<std::istream> read_maybe_compressed_file( const fs::path &path )
 {
+    // The file may still be queued to be written
+    save_writer::flush();
     try {
         std::ifstream fin( path, std::ios::binary );
         if( !fin ) {
@@ -511,6 +514,7 @@ std::optional<std::string> read_whole_file( const std::string &path )
 
 std::optional<std::string> read_whole_file( const fs::path &path )
 {
+    save_writer::flush();
     std::string outstring;
     try {
         std::ifstream fin( path, std::ios::binary );
@@ -554,6 +558,7 @@ std::optional<std::string> read_whole_file( const cata_path &path )
 bool read_from_file_json( const cata_path &path,
                           const std::function<void( const JsonValue & )> &reader )
 {
+    save_writer::flush();
     try {
         JsonValue jo = json_loader::from_path( path );
         reader( jo );
@@ -571,6 +576,7 @@ bool read_from_file_optional( const std::string &path,
     // Note: slight race condition here, but we'll ignore it. Worst case: the file
     // exists and got removed before reading it -> reading fails with a message
     // Or file does not exists, than everything works fine because it's optional anyway.
+    save_writer::flush();
     return file_exist( path ) && read_from_file( path, reader );
 }
 
@@ -580,6 +586,7 @@ bool read_from_file_optional( const fs::path &path,
     // Note: slight race condition here, but we'll ignore it. Worst case: the file
     // exists and got removed before reading it -> reading fails with a message
     // Or file does not exists, than everything works fine because it's optional anyway.
+    save_writer::flush();
     return file_exist( path ) && read_from_file( path, reader );
 }
 
@@ -592,6 +599,7 @@ bool read_from_file_optional( const cata_path &path,
 bool read_from_file_optional_json( const cata_path &path,
                                    const std::function<void( const JsonValue & )> &reader )
 {
+    save_writer::flush();
     return file_exist( path.get_unrelative_path() ) && read_from_file_json( path, reader );
 }
 
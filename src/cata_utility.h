@@ -608,12 +608,12 @@ bool equal_ignoring_elements( const Set &set, const Set &set2, const Set &ignore
 }
 
 /**
- * Return a copy of a std::map with some keys removed.
+ * Return a copy of a map (std::map, cata::flat_map) with some keys removed.
  */
-template<typename K, typename V>
-std::map<K, V> map_without_keys( const std::map<K, V> &original, const std::vector<K> &remove_keys )
+template<typename Map, typename K>
+Map map_without_keys( const Map &original, const std::vector<K> &remove_keys )
 {
-    std::map<K, V> filtered( original );
+    Map filtered( original );
     for( const K &key : remove_keys ) {
         filtered.erase( key );
     }
@@ -57,6 +57,7 @@
 #include "gun_mode.h"
 #include "handle_liquid.h"
 #include "input.h"
+#include "interned_flag.h"
 #include "inventory.h"
 #include "item_location.h"
 #include "item_pocket.h"
@@ -275,6 +276,8 @@ static const field_type_str_id field_fd_clairvoyant( "fd_clairvoyant" );
 
 static const furn_str_id furn_f_null( "f_null" );
 
+static const interned_flag flag_BRIDGE( "BRIDGE" );
+
 static const itype_id fuel_type_animal( "animal" );
 static const itype_id fuel_type_muscle( "muscle" );
 static const itype_id itype_UPS( "UPS" );
@@ -645,6 +648,7 @@ item_location Character::get_wielded_item()
 void Character::set_wielded_item( const item &to_wield )
 {
     weapon = to_wield;
+    invalidate_item_index();
 }
 
 int Character::get_oxygen_max() const
@@ -2826,6 +2830,7 @@ item Character::remove_weapon()
 {
     item tmp = weapon;
     weapon = item();
+    invalidate_item_index();
     get_event_bus().send<event_type::character_wields_item>( getID(), weapon.typeId() );
     cached_info.erase( "weapon_value" );
     return tmp;
@@ -2858,6 +2863,35 @@ units::mass Character::weight_carried() const
 void Character::invalidate_weight_carried_cache()
 {
     cached_weight_carried = std::nullopt;
+    invalidate_item_index();
+}
+
+Character::item_index_scope::item_index_scope( const Character &who ) : who( who )
+{
+    who.cached_item_index.scopes++;
+}
+
+Character::item_index_scope::~item_index_scope()
+{
+    if( --who.cached_item_index.scopes == 0 ) {
+        who.invalidate_item_index();
+    }
+}
+
+void Character::invalidate_item_index() const
+{
+    cached_item_index.index.reset();
+}
+
+const item_index *Character::get_item_index() const
+{
+    if( cached_item_index.scopes == 0 ) {
+        return nullptr;
+    }
+    if( !cached_item_index.index ) {
+        cached_item_index.index.emplace( *this );
+    }
+    return &*cached_item_index.index;
 }
 
 units::mass Character::best_nearby_lifting_assist() const
@@ -3084,6 +3118,7 @@ ret_val<void> Character::can_unwield( const item &it ) const
 void Character::invalidate_inventory_validity_cache()
 {
     cache_inventory_is_valid = false;
+    invalidate_item_index();
 }
 bool Character::is_wielding( const item &target ) const
 {
@@ -6588,7 +6623,7 @@ void Character::burn_move_stamina( int moves )
     if( get_map().has_flag( ter_furn_flag::TFLAG_DEEP_WATER, pos() ) &&
         ( !has_flag( json_flag_WALK_UNDERWATER ) ||
           get_map().has_flag( ter_furn_flag::TFLAG_GOES_DOWN, pos() ) ) &&
-        !get_map().has_flag_furn( "BRIDGE", pos() ) &&
+        !get_map().has_flag_furn( flag_BRIDGE, pos() ) &&
         !( in_vehicle && get_map().veh_at( pos() )->vehicle().can_float() ) ) {
         burn_ratio += 100 / std::pow( 1.1, get_skill_level( skill_swimming ) );
     }
@@ -11987,7 +12022,7 @@ void Character::pause()
     map &here = get_map();
 
     // effects of being partially/fully underwater
-    if( !in_vehicle && !get_map().has_flag_furn( "BRIDGE", pos( ) ) ) {
+    if( !in_vehicle && !get_map().has_flag_furn( flag_BRIDGE, pos( ) ) ) {
         if( underwater ) {
             // TODO: gain "swimming" proficiency but not "athletics" skill
             drench( 100, get_drenching_body_parts(), false );
@@ -40,6 +40,7 @@
 #include "flat_set.h"
 #include "game_constants.h"
 #include "item.h"
+#include "item_index.h"
 #include "item_location.h"
 #include "item_pocket.h"
 #include "magic_enchantment.h"
@@ -2161,6 +2162,25 @@ class Character : public Creature, public visitable
         void invalidate_inventory_validity_cache();
 
         void invalidate_weight_carried_cache();
+
+        /**
+         * While one of these exists for the character, its amount_of(), charges_of(),
+         * has_quality() and max_quality() are answered from an @ref item_index built on first use
+         * instead of walking all carried items each time. For code asking many of these in a row.
+         * Adding, removing, wearing and wielding items drops the index, other changes to carried
+         * items within the scope need @ref invalidate_item_index.
+         */
+        class item_index_scope
+        {
+            public:
+                explicit item_index_scope( const Character &who );
+                ~item_index_scope();
+                item_index_scope( const item_index_scope & ) = delete;
+                item_index_scope &operator=( const item_index_scope & ) = delete;
+            private:
+                const Character &who;
+        };
+        void invalidate_item_index() const;
         /** Returns all items that must be taken off before taking off this item */
         std::list<item *> get_dependent_worn_items( const item &it );
         /** Drops an item to the specified location */
@@ -3096,6 +3116,10 @@ class Character : public Creature, public visitable
         const inventory &crafting_inventory( const tripoint &src_pos = tripoint_zero,
                                              int radius = PICKUP_RANGE, bool clear_path = true ) const;
         void invalidate_crafting_inventory();
+        /** Changes whenever the crafting inventory is formed again or invalidated. */
+        int crafting_inventory_generation() const {
+            return crafting_cache.generation;
+        }
 
         /** Returns a value from 1.0 to 11.0 that acts as a multiplier
          * for the time taken to perform tasks that require detail vision,
@@ -3554,6 +3578,29 @@ class Character : public Creature, public visitable
          * If it is nullopt, needs to be recalculated
          */
         mutable std::optional<units::mass> cached_weight_carried = std::nullopt;
+        /**
+         * The index of carried items and the number of open @ref item_index_scope, the index is
+         * only kept while there is one. Neither moves along with the character: the scopes refer
+         * to this object and the index to the items it had, so both ends drop the index, and an
+         * assigned to character keeps counting its own scopes.
+         */
+        struct item_index_cache {
+            int scopes = 0;
+            std::optional<item_index> index;
+
+            item_index_cache() = default;
+            item_index_cache( item_index_cache &&other ) noexcept {
+                other.index.reset();
+            }
+            item_index_cache &operator=( item_index_cache &&other ) noexcept {
+                index.reset();
+                other.index.reset();
+                return *this;
+            }
+        };
+        mutable item_index_cache cached_item_index;
+        /** The index of carried items, or nullptr outside of an @ref item_index_scope. */
+        const item_index *get_item_index() const;
 
         void store( JsonOut &json ) const;
         void load( const JsonObject &data );
@@ -3687,6 +3734,7 @@ class Character : public Creature, public visitable
             int moves;
             tripoint position;
             int radius;
+            int generation = 0;
             pimpl<inventory> crafting_inventory;
         };
         mutable crafting_cache_type crafting_cache;
@@ -688,6 +688,7 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
 void zone_manager::cache_data( bool update_avatar )
 {
     area_cache.clear();
+    cache_generation++;
     avatar &player_character = get_avatar();
     tripoint_abs_ms cached_shift = player_character.get_location();
     for( zone_data &elem : zones ) {
@@ -743,6 +744,7 @@ void zone_manager::cache_avatar_location()
 void zone_manager::cache_vzones( map *pmap )
 {
     vzone_cache.clear();
+    cache_generation++;
     map &here = pmap == nullptr ? get_map() : *pmap;
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z() );
     for( zone_data *elem : vzones ) {
@@ -763,12 +765,13 @@ void zone_manager::cache_vzones( map *pmap )
     }
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_point_set( const zone_type_id &type,
-        const faction_id &fac ) const
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_point_set(
+    const zone_type_id &type, const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint_abs_ms> no_points;
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return no_points;
     }
 
     return type_iter->second;
@@ -798,13 +801,14 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
     return res;
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type_id &type,
-        const faction_id &fac ) const
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_vzone_set(
+    const zone_type_id &type, const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint_abs_ms> no_points;
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return no_points;
     }
 
     return type_iter->second;
@@ -911,6 +915,31 @@ std::vector<zone_data const *> zone_manager::get_zones_at( const tripoint_abs_ms
     return ret;
 }
 
+// What a custom or item group loot zone takes, judged by the item itself or its only content
+static std::function<bool( const item & )> loot_zone_filter( const zone_data &zone )
+{
+    loot_options const &options = dynamic_cast<const loot_options &>( zone.get_options() );
+    std::string const filter_string = options.get_mark();
+    if( zone.get_type() == zone_type_LOOT_CUSTOM ) {
+        auto const z = item_filter_from_string( filter_string );
+        return [z]( const item & it ) {
+            item const *const check_it = it.this_or_single_content();
+            return z( *check_it ) || ( check_it != &it && z( it ) );
+        };
+    }
+    if( zone.get_type() == zone_type_LOOT_ITEM_GROUP ) {
+        const item_group_id group( filter_string );
+        return [group]( const item & it ) {
+            item const *const check_it = it.this_or_single_content();
+            return item_group::group_contains_item( group, check_it->typeId() ) ||
+                   ( check_it != &it && item_group::group_contains_item( group, it.typeId() ) );
+        };
+    }
+    return []( const item & ) {
+        return false;
+    };
+}
+
 bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it,
                                     const zone_type_id &ztype, const faction_id &fac ) const
 {
@@ -918,22 +947,8 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
     if( zones.empty() || !it ) {
         return false;
     }
-    item const *const check_it = it->this_or_single_content();
     for( zone_data const *zone : zones ) {
-        loot_options const &options = dynamic_cast<const loot_options &>( zone->get_options() );
-        std::string const filter_string = options.get_mark();
-        bool has = false;
-        if( ztype == zone_type_LOOT_CUSTOM ) {
-            auto const z = item_filter_from_string( filter_string );
-            has = z( *check_it ) || ( check_it != it && z( *it ) );
-        } else if( ztype == zone_type_LOOT_ITEM_GROUP ) {
-            has = item_group::group_contains_item( item_group_id( filter_string ),
-                                                   check_it->typeId() ) ||
-                  ( check_it != it &&
-                    item_group::group_contains_item( item_group_id( filter_string ),
-                            it->typeId() ) );
-        }
-        if( has ) {
+        if( loot_zone_filter( *zone )( *it ) ) {
             return true;
         }
     }
@@ -1009,44 +1024,43 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
     return nearest_pos;
 }
 
-zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
-        const tripoint_abs_ms &where, int range, const faction_id &fac ) const
+// The loot zone type an item is sorted to. has_near( type ) tells whether there is a zone of
+// that type in range, has_custom( type ) whether a custom or item group zone in range takes it.
+template<typename HasNear, typename HasCustom>
+static zone_type_id zone_type_for_item( const item &it, const HasNear &has_near,
+                                        const HasCustom &has_custom )
 {
     const item_category &cat = it.get_category_of_contents();
 
-    if( has_near( zone_type_LOOT_CUSTOM, where, range, fac ) ) {
-        if( !get_near( zone_type_LOOT_CUSTOM, where, range, &it, fac ).empty() ) {
-            return zone_type_LOOT_CUSTOM;
-        }
+    if( has_near( zone_type_LOOT_CUSTOM ) && has_custom( zone_type_LOOT_CUSTOM ) ) {
+        return zone_type_LOOT_CUSTOM;
     }
-    if( has_near( zone_type_LOOT_ITEM_GROUP, where, range, fac ) ) {
-        if( !get_near( zone_type_LOOT_ITEM_GROUP, where, range, &it, fac ).empty() ) {
-            return zone_type_LOOT_ITEM_GROUP;
-        }
+    if( has_near( zone_type_LOOT_ITEM_GROUP ) && has_custom( zone_type_LOOT_ITEM_GROUP ) ) {
+        return zone_type_LOOT_ITEM_GROUP;
     }
     if( it.has_flag( STATIC( flag_id( "FIREWOOD" ) ) ) ) {
-        if( has_near( zone_type_LOOT_WOOD, where, range, fac ) ) {
+        if( has_near( zone_type_LOOT_WOOD ) ) {
             return zone_type_LOOT_WOOD;
         }
     }
     if( it.is_corpse() ) {
-        if( has_near( zone_type_LOOT_CORPSE, where, range, fac ) ) {
+        if( has_near( zone_type_LOOT_CORPSE ) ) {
             return zone_type_LOOT_CORPSE;
         }
     }
     if( it.typeId() == itype_disassembly ) {
-        if( has_near( zone_type_zone_disassemble, where, range, fac ) ) {
+        if( has_near( zone_type_zone_disassemble ) ) {
             return zone_type_zone_disassemble;
         }
     }
 
     std::optional<zone_type_id> zone_check_first = cat.priority_zone( it );
-    if( zone_check_first && has_near( *zone_check_first, where, range, fac ) ) {
+    if( zone_check_first && has_near( *zone_check_first ) ) {
         return *zone_check_first;
     }
 
     std::optional<zone_type_id> zone_cat = cat.zone();
-    if( zone_cat && has_near( *zone_cat, where, range, fac ) ) {
+    if( zone_cat && has_near( *zone_cat ) ) {
         return *cat.zone();
     }
 
@@ -1077,14 +1091,14 @@ zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
 
         if( it_food != nullptr ) {
             if( it_food->get_comestible()->comesttype == "DRINK" ) {
-                if( perishable && has_near( zone_type_LOOT_PDRINK, where, range, fac ) ) {
+                if( perishable && has_near( zone_type_LOOT_PDRINK ) ) {
                     return zone_type_LOOT_PDRINK;
-                } else if( has_near( zone_type_LOOT_DRINK, where, range, fac ) ) {
+                } else if( has_near( zone_type_LOOT_DRINK ) ) {
                     return zone_type_LOOT_DRINK;
                 }
             }
 
-            if( perishable && has_near( zone_type_LOOT_PFOOD, where, range, fac ) ) {
+            if( perishable && has_near( zone_type_LOOT_PFOOD ) ) {
                 return zone_type_LOOT_PFOOD;
             }
         }
@@ -1095,6 +1109,176 @@ zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
     return zone_type_id();
 }
 
+zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
+        const tripoint_abs_ms &where, int range, const faction_id &fac ) const
+{
+    return zone_type_for_item( it, [&]( const zone_type_id & type ) {
+        return has_near( type, where, range, fac );
+    }, [&]( const zone_type_id & type ) {
+        return !get_near( type, where, range, &it, fac ).empty();
+    } );
+}
+
+loot_zone_index::loot_zone_index( const zone_manager &mgr, const tripoint_abs_ms &origin,
+                                  const int range, const faction_id &fac )
+    : origin( origin ), range( range ), fac( fac ), generation( mgr.cache_generation ),
+      nearest_from( origin )
+{
+    const auto in_reach = [&]( const tripoint_abs_ms & p ) {
+        return square_dist( p, origin ) <= 2 * range;
+    };
+    for( const auto &type : mgr.get_types() ) {
+        type_points entry;
+        for( const tripoint_abs_ms &p : mgr.get_point_set( type.first, fac ) ) {
+            if( in_reach( p ) ) {
+                entry.area.insert( p );
+            }
+        }
+        for( const tripoint_abs_ms &p : mgr.get_vzone_set( type.first, fac ) ) {
+            if( in_reach( p ) ) {
+                entry.vehicle.insert( p );
+            }
+        }
+        if( !entry.area.empty() || !entry.vehicle.empty() ) {
+            points.emplace( type.first, std::move( entry ) );
+        }
+    }
+
+    const auto add_filtered = [&]( const zone_data & zone ) {
+        // Disabled zones still filter, like in zone_manager::custom_loot_has
+        if( zone.get_faction() == fac &&
+            ( zone.get_type() == zone_type_LOOT_CUSTOM ||
+              zone.get_type() == zone_type_LOOT_ITEM_GROUP ) ) {
+            filtered_zones.push_back( { zone.get_type(), zone.get_start_point(),
+                                        zone.get_end_point(), loot_zone_filter( zone ) } );
+        }
+    };
+    for( const zone_data &zone : mgr.zones ) {
+        add_filtered( zone );
+    }
+    map &here = get_map();
+    for( const zone_data *zone : here.get_vehicle_zones( here.get_abs_sub().z() ) ) {
+        add_filtered( *zone );
+    }
+}
+
+bool loot_zone_index::covers( const zone_manager &mgr, const tripoint_abs_ms &where,
+                              const faction_id &fac ) const
+{
+    return generation == mgr.cache_generation && this->fac == fac &&
+           square_dist( where, origin ) <= range;
+}
+
+bool loot_zone_index::has( const zone_type_id &type, const tripoint_abs_ms &where ) const
+{
+    const auto it = points.find( type );
+    if( it == points.end() ) {
+        return false;
+    }
+    return it->second.area.count( where ) > 0 || it->second.vehicle.count( where ) > 0;
+}
+
+bool loot_zone_index::has_near( const zone_type_id &type, const tripoint_abs_ms &where,
+                                const int range ) const
+{
+    const auto it = points.find( type );
+    if( it == points.end() ) {
+        return false;
+    }
+    // Sorting asks about the same few types for every item on a tile
+    if( where != nearest_from ) {
+        nearest_from = where;
+        nearest_dist.clear();
+    }
+    auto found = nearest_dist.find( type );
+    if( found == nearest_dist.end() ) {
+        int dist = INT_MAX;
+        for( const tripoint_abs_ms &p : it->second.area ) {
+            dist = std::min( dist, square_dist( p, where ) );
+        }
+        for( const tripoint_abs_ms &p : it->second.vehicle ) {
+            if( p.z() == where.z() ) {
+                dist = std::min( dist, square_dist( p, where ) );
+            }
+        }
+        found = nearest_dist.emplace( type, dist ).first;
+    }
+    return found->second <= range;
+}
+
+bool loot_zone_index::custom_loot_has( const tripoint_abs_ms &where, const item &it,
+                                       const zone_type_id &ztype ) const
+{
+    return std::any_of( filtered_zones.begin(), filtered_zones.end(),
+    [&]( const filtered_zone & zone ) {
+        return zone.type == ztype &&
+               inclusive_cuboid<tripoint_abs_ms>( zone.start, zone.end ).contains( where ) &&
+               zone.accepts( it );
+    } );
+}
+
+std::vector<tripoint_abs_ms> loot_zone_index::get_near( const zone_type_id &type,
+        const tripoint_abs_ms &where, const int range, const item *it ) const
+{
+    std::vector<tripoint_abs_ms> near_points;
+    const auto type_it = points.find( type );
+    if( type_it == points.end() ) {
+        return near_points;
+    }
+    const bool filtered = type == zone_type_LOOT_CUSTOM || type == zone_type_LOOT_ITEM_GROUP;
+    if( filtered && it == nullptr ) {
+        return near_points;
+    }
+    // Check each filter once rather than for every point of the zones
+    std::vector<const filtered_zone *> accepting;
+    if( filtered ) {
+        for( const filtered_zone &zone : filtered_zones ) {
+            if( zone.type == type && zone.accepts( *it ) ) {
+                accepting.push_back( &zone );
+            }
+        }
+    }
+    const auto add_point = [&]( const tripoint_abs_ms & p ) {
+        if( square_dist( p, where ) > range ) {
+            return;
+        }
+        if( filtered && std::none_of( accepting.begin(), accepting.end(),
+        [&p]( const filtered_zone * zone ) {
+        return inclusive_cuboid<tripoint_abs_ms>( zone->start, zone->end ).contains( p );
+        } ) ) {
+            return;
+        }
+        near_points.push_back( p );
+    };
+    for( const tripoint_abs_ms &p : type_it->second.area ) {
+        add_point( p );
+    }
+    for( const tripoint_abs_ms &p : type_it->second.vehicle ) {
+        if( p.z() == where.z() ) {
+            add_point( p );
+        }
+    }
+    std::sort( near_points.begin(), near_points.end(),
+    [&where]( const tripoint_abs_ms & a, const tripoint_abs_ms & b ) {
+        const int dist_a = square_dist( a, where );
+        const int dist_b = square_dist( b, where );
+        return dist_a < dist_b || ( dist_a == dist_b && a < b );
+    } );
+    // A vehicle zone may cover the same point as a fixed one
+    near_points.erase( std::unique( near_points.begin(), near_points.end() ), near_points.end() );
+    return near_points;
+}
+
+zone_type_id loot_zone_index::get_near_zone_type_for_item( const item &it,
+        const tripoint_abs_ms &where, const int range ) const
+{
+    return zone_type_for_item( it, [&]( const zone_type_id & type ) {
+        return has_near( type, where, range );
+    }, [&]( const zone_type_id & type ) {
+        return !get_near( type, where, range, &it ).empty();
+    } );
+}
+
 std::vector<zone_data> zone_manager::get_zones( const zone_type_id &type,
         const tripoint_abs_ms &where, const faction_id &fac ) const
 {
@@ -470,10 +470,14 @@ class zone_manager
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> vzone_cache;
-        std::unordered_set<tripoint_abs_ms> get_point_set( const zone_type_id &type,
+        // Incremented whenever the caches above are rebuilt
+        int cache_generation = 0; // NOLINT(cata-serialize)
+        const std::unordered_set<tripoint_abs_ms> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint_abs_ms> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint_abs_ms> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
+
+        friend class loot_zone_index;
     public:
         zone_manager();
         ~zone_manager() = default;
@@ -569,6 +573,60 @@ class zone_manager
         void deserialize( const JsonValue &jv );
 };
 
+/**
+ * Snapshot of the zones around a loot sorter, taken when sorting starts. It answers the zone
+ * queries sorting makes for every item, the same as @ref zone_manager does, from points indexed
+ * by zone type, and with the filters of custom and item group zones parsed once.
+ */
+class loot_zone_index
+{
+    public:
+        /**
+         * Indexes the zones of faction fac that the sorter can use while within range of origin,
+         * i.e. those up to twice that range away.
+         */
+        loot_zone_index( const zone_manager &mgr, const tripoint_abs_ms &origin, int range,
+                         const faction_id &fac );
+
+        /** Whether queries from where can still be answered, zones did not change since. */
+        bool covers( const zone_manager &mgr, const tripoint_abs_ms &where,
+                     const faction_id &fac ) const;
+
+        bool has( const zone_type_id &type, const tripoint_abs_ms &where ) const;
+        bool has_near( const zone_type_id &type, const tripoint_abs_ms &where, int range ) const;
+        bool custom_loot_has( const tripoint_abs_ms &where, const item &it,
+                              const zone_type_id &ztype ) const;
+        /** Like @ref zone_manager::get_near, ordered by distance to where, nearest first. */
+        std::vector<tripoint_abs_ms> get_near( const zone_type_id &type,
+                                               const tripoint_abs_ms &where, int range,
+                                               const item *it ) const;
+        zone_type_id get_near_zone_type_for_item( const item &it, const tripoint_abs_ms &where,
+                int range ) const;
+
+    private:
+        struct type_points {
+            std::unordered_set<tripoint_abs_ms> area;
+            // Only found on the z-level of the query
+            std::unordered_set<tripoint_abs_ms> vehicle;
+        };
+        struct filtered_zone {
+            zone_type_id type;
+            tripoint_abs_ms start;
+            tripoint_abs_ms end;
+            std::function<bool( const item & )> accepts;
+        };
+
+        tripoint_abs_ms origin;
+        int range;
+        faction_id fac;
+        int generation;
+        std::unordered_map<zone_type_id, type_points> points;
+        std::vector<filtered_zone> filtered_zones;
+        // Distance from nearest_from to the closest point of each type, filled as asked for
+        mutable tripoint_abs_ms nearest_from;
+        mutable std::unordered_map<zone_type_id, int> nearest_dist;
+};
+
 void mapgen_place_zone( tripoint const &start, tripoint const &end, zone_type_id const &type,
                         faction_id const &fac = your_fac, std::string const &name = {},
                         std::string const &filter = {}, map *pmap = nullptr );
@@ -581,6 +581,7 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
         && inv_pos == crafting_cache.position ) {
         return *crafting_cache.crafting_inventory;
     }
+    crafting_cache.generation++;
     crafting_cache.crafting_inventory->clear();
     if( radius >= 0 ) {
         crafting_cache.crafting_inventory->form_from_map( inv_pos, radius, this, false, clear_path );
@@ -627,6 +628,7 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
 void Character::invalidate_crafting_inventory()
 {
     crafting_cache.valid = false;
+    crafting_cache.generation++;
     crafting_cache.crafting_inventory->clear();
 }
 
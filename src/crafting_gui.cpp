@@ -291,6 +291,35 @@ struct availability {
             return false;
         }
 };
+
+/**
+ * Availability of recipes at the batch sizes asked for, kept until the crafting inventory
+ * changes. Which tools and qualities that inventory has is remembered across all recipes.
+ */
+class recipe_availability_cache
+{
+    public:
+        const availability &get( const recipe *r, int batch_size = 1 ) {
+            const Character &player = get_player_character();
+            const inventory &inv = player.crafting_inventory();
+            if( player.crafting_inventory_generation() != inventory_generation ) {
+                cache.clear();
+                checks.reset();
+                checks.emplace( inv );
+                inventory_generation = player.crafting_inventory_generation();
+            }
+            const std::pair<const recipe *, int> key( r, batch_size );
+            auto it = cache.find( key );
+            if( it == cache.end() ) {
+                it = cache.emplace( key, availability( r, batch_size ) ).first;
+            }
+            return it->second;
+        }
+    private:
+        int inventory_generation = -1;
+        std::optional<requirement_check_cache> checks;
+        std::map<std::pair<const recipe *, int>, availability> cache;
+};
 } // namespace
 
 static std::string craft_success_chance_string( const recipe &recp, const Character &guy )
@@ -990,7 +1019,7 @@ static bool mouse_in_window( std::optional<point> coord, const catacurses::windo
 }
 
 static void recursively_expance_recipes( std::vector<const recipe *> &current,
-        std::vector<int> &indent, std::map<const recipe *, availability> &availability_cache, int i,
+        std::vector<int> &indent, recipe_availability_cache &availability_cache, int i,
         Character &player_character, bool unread_recipes_first, bool highlight_unread_recipes,
         const recipe_subset &available_recipes, const std::set<recipe_id> &hidden_recipes )
 {
@@ -1002,9 +1031,6 @@ static void recursively_expance_recipes( std::vector<const recipe *> &current,
             // only do this if we can actually craft the recipe
             tmp.push_back( &nested.obj() );
             indent.insert( indent.begin() + i + 1, indent[i] + 2 );
-            if( !availability_cache.count( &nested.obj() ) ) {
-                availability_cache.emplace( &nested.obj(), availability( &nested.obj() ) );
-            }
         }
     }
 
@@ -1019,8 +1045,8 @@ static void recursively_expance_recipes( std::vector<const recipe *> &current,
                 return !a_read;
             }
         }
-        const bool can_craft_a = availability_cache.at( a ).can_craft;
-        const bool can_craft_b = availability_cache.at( b ).can_craft;
+        const bool can_craft_a = availability_cache.get( a ).can_craft;
+        const bool can_craft_b = availability_cache.get( b ).can_craft;
         if( can_craft_a != can_craft_b ) {
             return can_craft_a;
         }
@@ -1041,7 +1067,7 @@ static void recursively_expance_recipes( std::vector<const recipe *> &current,
 
 // take the current and itterate through expanding each recipe
 static void expand_recipes( std::vector<const recipe *> &current,
-                            std::vector<int> &indent, std::map<const recipe *, availability> &availability_cache,
+                            std::vector<int> &indent, recipe_availability_cache &availability_cache,
                             Character &player_character, bool unread_recipes_first, bool highlight_unread_recipes,
                             const recipe_subset &available_recipes, const std::set<recipe_id> &hidden_recipes )
 {
@@ -1242,7 +1268,7 @@ const recipe *select_crafting_recipe( int &batch_size_out, const recipe_id &goto
 
     const recipe_subset &available_recipes = player_character.get_available_recipes( crafting_inv,
             &helpers );
-    std::map<const recipe *, availability> availability_cache;
+    recipe_availability_cache availability_cache;
 
     const std::string new_recipe_str = pgettext( "crafting gui", "NEW!" );
     const nc_color new_recipe_str_col = c_light_green;
@@ -1498,7 +1524,7 @@ const recipe *select_crafting_recipe( int &batch_size_out, const recipe_id &goto
                 current.clear();
                 for( int i = 1; i <= 50; i++ ) {
                     current.push_back( chosen );
-                    available.emplace_back( chosen, i );
+                    available.push_back( availability_cache.get( chosen, i ) );
                 }
                 indent.assign( current.size(), 0 );
             } else {
@@ -1549,12 +1575,6 @@ const recipe *select_crafting_recipe( int &batch_size_out, const recipe_id &goto
                 }
 
                 available.reserve( current.size() );
-                // cache recipe availability on first display
-                for( const recipe *e : current ) {
-                    if( !availability_cache.count( e ) ) {
-                        availability_cache.emplace( e, availability( e ) );
-                    }
-                }
 
                 if( subtab.cur() != "CSC_*_RECENT" ) {
                     std::stable_sort( current.begin(), current.end(), [
@@ -1568,8 +1588,8 @@ const recipe *select_crafting_recipe( int &batch_size_out, const recipe_id &goto
                                 return !a_read;
                             }
                         }
-                        const bool can_craft_a = availability_cache.at( a ).can_craft;
-                        const bool can_craft_b = availability_cache.at( b ).can_craft;
+                        const bool can_craft_a = availability_cache.get( a ).can_craft;
+                        const bool can_craft_b = availability_cache.get( b ).can_craft;
                         if( can_craft_a != can_craft_b ) {
                             return can_craft_a;
                         }
@@ -1594,7 +1614,7 @@ const recipe *select_crafting_recipe( int &batch_size_out, const recipe_id &goto
 
                 std::transform( current.begin(), current.end(),
                 std::back_inserter( available ), [&]( const recipe * e ) {
-                    return availability_cache.at( e );
+                    return availability_cache.get( e );
                 } );
             }
 
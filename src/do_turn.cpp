@@ -1,6 +1,10 @@
 #include "do_turn.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "action.h"
+#include "ai_lod.h"
 #include "avatar.h"
 #include "bionics.h"
 #include "cached_options.h"
@@ -9,12 +13,14 @@
 #include "event_bus.h"
 #include "explosion.h"
 #include "game.h"
+#include "game_constants.h"
 #include "gamemode.h"
 #include "help.h"
 #include "kill_tracker.h"
 #include "make_static.h"
 #include "map.h"
 #include "mapbuffer.h"
+#include "mapgen_prefetch.h"
 #include "memorial_logger.h"
 #include "messages.h"
 #include "mission.h"
@@ -225,6 +231,12 @@ void monmove()
     map &m = get_map();
     avatar &u = get_avatar();
 
+    const int lod_interval = get_option<int>( "AI_LOD_INTERVAL" );
+    std::vector<tripoint> watchers = { u.pos() };
+    for( const npc &guy : g->all_npcs() ) {
+        watchers.push_back( guy.pos() );
+    }
+
     for( monster &critter : g->all_monsters() ) {
         // Critters in impassable tiles get pushed away, unless it's not impassable for them
         if( !critter.is_dead() && m.impassable( critter.pos() ) && !critter.can_move_to( critter.pos() ) ) {
@@ -261,7 +273,10 @@ void monmove()
             critter.try_biosignature();
             critter.try_reproduce();
         }
-        while( critter.moves > 0 && !critter.is_dead() && !critter.has_effect( effect_ridden ) ) {
+        // Idle monsters far away keep their moves for a later turn
+        const bool acts = ai_lod::should_act( critter, watchers, lod_interval );
+        while( acts && critter.moves > 0 && !critter.is_dead() &&
+               !critter.has_effect( effect_ridden ) ) {
             critter.made_footstep = false;
             // Controlled critters don't make their own plans
             if( !critter.has_effect( effect_controlled ) ) {
@@ -476,6 +491,17 @@ bool do_turn()
         g->autosave();
     }
 
+    // Keep the submaps visited on long trips from piling up in memory
+    if( calendar::once_every( 1_minutes ) ) {
+        const int max_submaps = get_option<int>( "RESIDENT_SUBMAPS" );
+        if( max_submaps > 0 ) {
+            // Never less than a few reality bubbles worth
+            MAPBUFFER.unload_least_recently_used( std::max( max_submaps,
+                                                  4 * MAPSIZE * MAPSIZE * OVERMAP_LAYERS ) );
+        }
+    }
+    mapgen_prefetch::update( get_option<int>( "MAPGEN_PREFETCH" ) );
+
     weather.update_weather();
     g->reset_light_level();
 
@@ -63,6 +63,11 @@ class enum_bitset
             return bits.test( get_pos( e ) );
         }
 
+        /** Whether any of the bits set in mask is also set here. */
+        bool test_any( const enum_bitset &mask ) const noexcept {
+            return ( bits & mask.bits ).any();
+        }
+
         static constexpr size_t size() noexcept {
             return get_pos( enum_traits<E>::last );
         }
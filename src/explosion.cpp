@@ -5,14 +5,13 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <limits>
 #include <map>
 #include <memory>
 #include <optional>
-#include <queue>
 #include <random>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -25,6 +24,7 @@
 #include "color.h"
 #include "creature.h"
 #include "creature_tracker.h"
+#include "cuboid_rectangle.h"
 #include "damage.h"
 #include "debug.h"
 #include "enums.h"
@@ -41,6 +41,7 @@
 #include "map.h"
 #include "map_iterator.h"
 #include "mapdata.h"
+#include "mdarray.h"
 #include "math_defines.h"
 #include "messages.h"
 #include "mongroup.h"
@@ -160,9 +161,136 @@ static float gurney_spherical( const double charge, const double mass )
                                          -0.5 ) * TYPICAL_GURNEY_CONSTANT );
 }
 
+namespace
+{
+// Per-tile bookkeeping for blast propagation.
+// A cell only holds meaningful data if its generation matches the current blast,
+// which lets the buffers be reused without clearing them between blasts.
+struct blast_cell {
+    float dist = std::numeric_limits<float>::max();
+    uint32_t generation = 0;
+    bool closed = false;
+    bool bashed = false;
+};
+
+using obstacle_cache_t = cata::mdarray<fragment_cloud, point_bub_ms>;
+
+// Scratch state shared by all explosions processed in one batch.
+// Chain reactions (cook-offs, exploding vehicles) can queue dozens of explosions at once,
+// so the reality bubble sized buffers are allocated once and reused, and the obstacle cache
+// for each z-level is built once per batch and then patched where blasts changed the terrain.
+struct explosion_scratch {
+    std::array<std::vector<blast_cell>, OVERMAP_LAYERS> blast_layers;
+    uint32_t blast_generation = 0;
+    // Dijkstra buckets, bucket N holds open tiles at distance [N, N + 1).
+    // The cheapest step is one tile, so tiles in one bucket can never improve each other.
+    std::vector<std::vector<std::pair<float, tripoint>>> open_buckets;
+    // Tiles reached by the current blast, in the order they were settled.
+    std::vector<tripoint> blasted;
+
+    std::unique_ptr<obstacle_cache_t> visited_cache;
+    std::array<std::unique_ptr<obstacle_cache_t>, OVERMAP_LAYERS> obstacle_caches;
+    std::array<bool, OVERMAP_LAYERS> obstacle_cache_valid = {};
+    // Submaps whose obstacles may have changed since the cache for that z-level was built.
+    std::array<std::optional<inclusive_rectangle<point>>, OVERMAP_LAYERS> obstacle_dirty;
+
+    void begin_batch() {
+        obstacle_cache_valid.fill( false );
+        obstacle_dirty.fill( std::nullopt );
+    }
+
+    void begin_blast() {
+        blasted.clear();
+        if( ++blast_generation == 0 ) {
+            // Generation counter wrapped around, stale cells could look current again.
+            for( std::vector<blast_cell> &layer : blast_layers ) {
+                std::fill( layer.begin(), layer.end(), blast_cell() );
+            }
+            blast_generation = 1;
+        }
+    }
+
+    // p must be inbounds
+    blast_cell &cell( const tripoint &p ) {
+        std::vector<blast_cell> &layer = blast_layers[p.z + OVERMAP_DEPTH];
+        if( layer.empty() ) {
+            layer.resize( static_cast<size_t>( MAPSIZE_X ) * MAPSIZE_Y );
+        }
+        blast_cell &c = layer[p.x * MAPSIZE_Y + p.y];
+        if( c.generation != blast_generation ) {
+            c = blast_cell();
+            c.generation = blast_generation;
+        }
+        return c;
+    }
+
+    void push_open( float dist, const tripoint &p ) {
+        const size_t bucket = static_cast<size_t>( dist );
+        if( bucket >= open_buckets.size() ) {
+            open_buckets.resize( bucket + 1 );
+        }
+        open_buckets[bucket].emplace_back( dist, p );
+    }
+
+    // Record that the obstacle at p may have been destroyed.
+    void mark_obstacle_dirty( const tripoint &p ) {
+        const size_t z = p.z + OVERMAP_DEPTH;
+        if( !obstacle_cache_valid[z] ) {
+            return;
+        }
+        const point sm( p.x / SEEX, p.y / SEEY );
+        std::optional<inclusive_rectangle<point>> &dirty = obstacle_dirty[z];
+        if( !dirty ) {
+            dirty = inclusive_rectangle<point>( sm, sm );
+        } else {
+            dirty->p_min = point( std::min( dirty->p_min.x, sm.x ),
+                                  std::min( dirty->p_min.y, sm.y ) );
+            dirty->p_max = point( std::max( dirty->p_max.x, sm.x ),
+                                  std::max( dirty->p_max.y, sm.y ) );
+        }
+    }
+
+    obstacle_cache_t &obstacle_cache( map &here, int zlev ) {
+        const size_t z = zlev + OVERMAP_DEPTH;
+        std::unique_ptr<obstacle_cache_t> &cache = obstacle_caches[z];
+        if( !cache ) {
+            cache = std::make_unique<obstacle_cache_t>();
+        }
+        if( !obstacle_cache_valid[z] ) {
+            const tripoint_range<tripoint> area = here.points_on_zlevel( zlev );
+            here.build_obstacle_cache( area.min(), area.max() + tripoint_south_east, *cache );
+            obstacle_cache_valid[z] = true;
+        } else if( obstacle_dirty[z] ) {
+            // Only rebuild the submaps earlier explosions in this batch may have changed.
+            const inclusive_rectangle<point> &dirty = *obstacle_dirty[z];
+            here.build_obstacle_cache( tripoint( dirty.p_min.x * SEEX, dirty.p_min.y * SEEY, zlev ),
+                                       tripoint( dirty.p_max.x * SEEX + SEEX - 1,
+                                                 dirty.p_max.y * SEEY + SEEY - 1, zlev ), *cache );
+        }
+        obstacle_dirty[z] = std::nullopt;
+        return *cache;
+    }
+
+    obstacle_cache_t &clean_visited_cache() {
+        if( !visited_cache ) {
+            visited_cache = std::make_unique<obstacle_cache_t>();
+        } else {
+            visited_cache->fill( fragment_cloud() );
+        }
+        return *visited_cache;
+    }
+};
+
+explosion_scratch &get_explosion_scratch()
+{
+    static explosion_scratch scratch;
+    return scratch;
+}
+} // namespace
+
 // (C1001) Compiler Internal Error on Visual Studio 2015 with Update 2
-static void do_blast( const Creature *source, const tripoint &p, const float power,
-                      const float distance_factor, const bool fire )
+static void do_blast( explosion_scratch &scratch, const Creature *source, const tripoint &p,
+                      const float power, const float distance_factor, const bool fire )
 {
     const float tile_dist = 1.0f;
     const float diag_dist = trigdist ? M_SQRT2 * tile_dist : 1.0f * tile_dist;
@@ -178,100 +306,111 @@ static void do_blast( const Creature *source, const tripoint &p, const float pow
     const size_t max_index = 10;
 
     here.bash( p, fire ? power : ( 2 * power ), true, false, false );
+    scratch.mark_obstacle_dirty( p );
 
-    std::priority_queue< std::pair<float, tripoint>, std::vector< std::pair<float, tripoint> >, pair_greater_cmp_first >
-    open;
-    std::set<tripoint> closed;
-    std::set<tripoint> bashed{ p };
-    std::map<tripoint, float> dist_map;
-    open.emplace( 0.0f, p );
-    dist_map[p] = 0.0f;
+    scratch.begin_blast();
+    blast_cell &origin = scratch.cell( p );
+    origin.bashed = true;
+    origin.dist = 0.0f;
+    scratch.push_open( 0.0f, p );
     // Find all points to blast
-    while( !open.empty() ) {
-        // Add some random factor to effective distance to make it look cooler
-        const float distance = open.top().first * rng_float( 1.0f, 1.2f );
-        const tripoint pt = open.top().second;
-        open.pop();
-
-        if( closed.count( pt ) != 0 ) {
-            continue;
-        }
-
-        closed.insert( pt );
-
-        const float force = power * std::pow( distance_factor, distance );
-        if( force <= 1.0f ) {
-            continue;
-        }
-
-        if( here.impassable( pt ) && pt != p ) {
-            // Don't propagate further
-            continue;
-        }
+    for( size_t bucket = 0; bucket < scratch.open_buckets.size(); ++bucket ) {
+        // Pushing to later buckets may reallocate, so don't hold a reference to this one
+        for( size_t n = 0; n < scratch.open_buckets[bucket].size(); ++n ) {
+            const float base_distance = scratch.open_buckets[bucket][n].first;
+            const tripoint pt = scratch.open_buckets[bucket][n].second;
+
+            blast_cell &current = scratch.cell( pt );
+            if( current.closed || base_distance > current.dist ) {
+                continue;
+            }
+            current.closed = true;
+            scratch.blasted.push_back( pt );
 
-        // Those will be used for making "shaped charges"
-        // Don't check up/down (for now) - this will make 2D/3D balancing easier
-        int empty_neighbors = 0;
-        for( size_t i = 0; i < 8; i++ ) {
-            tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
-            if( closed.count( dest ) == 0 && here.valid_move( pt, dest, false, true ) ) {
-                empty_neighbors++;
+            // Add some random factor to effective distance to make it look cooler
+            const float distance = base_distance * rng_float( 1.0f, 1.2f );
+            const float force = power * std::pow( distance_factor, distance );
+            if( force <= 1.0f ) {
+                continue;
             }
-        }
 
-        empty_neighbors = std::max( 1, empty_neighbors );
-        // Iterate over all neighbors. Bash all of them, propagate to some
-        for( size_t i = 0; i < max_index; i++ ) {
-            tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
-            if( closed.count( dest ) != 0 || !here.inbounds( dest ) ) {
+            if( here.impassable( pt ) && pt != p ) {
+                // Don't propagate further
                 continue;
             }
 
-            if( bashed.count( dest ) == 0 ) {
-                bashed.insert( dest );
-                // Up to 200% bonus for shaped charge
-                // But not if the explosion is fiery, then only half the force and no bonus
-                const float bash_force = !fire ?
-                                         force + ( 2 * force / empty_neighbors ) :
-                                         force / 2;
-                if( z_offset[i] == 0 ) {
-                    // Horizontal - no floor bashing
-                    here.bash( dest, bash_force, true, false, false );
-                } else if( z_offset[i] > 0 ) {
-                    // Should actually bash through the floor first, but that's not really possible yet
-                    here.bash( dest, bash_force, true, false, true );
-                } else if( !here.valid_move( pt, dest, false, true ) ) {
-                    // Only bash through floor if it doesn't exist
-                    // Bash the current tile's floor, not the one's below
-                    here.bash( pt, bash_force, true, false, true );
+            // Those will be used for making "shaped charges"
+            // Don't check up/down (for now) - this will make 2D/3D balancing easier
+            int empty_neighbors = 0;
+            for( size_t i = 0; i < 8; i++ ) {
+                tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
+                if( here.inbounds( dest ) && !scratch.cell( dest ).closed &&
+                    here.valid_move( pt, dest, false, true ) ) {
+                    empty_neighbors++;
                 }
             }
 
-            float next_dist = distance;
-            next_dist += ( x_offset[i] == 0 || y_offset[i] == 0 ) ? tile_dist : diag_dist;
-            if( z_offset[i] != 0 ) {
-                if( !here.valid_move( pt, dest, false, true ) ) {
+            empty_neighbors = std::max( 1, empty_neighbors );
+            // Iterate over all neighbors. Bash all of them, propagate to some
+            for( size_t i = 0; i < max_index; i++ ) {
+                tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
+                if( !here.inbounds( dest ) ) {
+                    continue;
+                }
+                blast_cell &neighbor = scratch.cell( dest );
+                if( neighbor.closed ) {
                     continue;
                 }
 
-                next_dist += zlev_dist;
-            }
+                if( !neighbor.bashed ) {
+                    neighbor.bashed = true;
+                    // Up to 200% bonus for shaped charge
+                    // But not if the explosion is fiery, then only half the force and no bonus
+                    const float bash_force = !fire ?
+                                             force + ( 2 * force / empty_neighbors ) :
+                                             force / 2;
+                    if( z_offset[i] == 0 ) {
+                        // Horizontal - no floor bashing
+                        here.bash( dest, bash_force, true, false, false );
+                    } else if( z_offset[i] > 0 ) {
+                        // Should actually bash through the floor first,
+                        // but that's not really possible yet
+                        here.bash( dest, bash_force, true, false, true );
+                    } else if( !here.valid_move( pt, dest, false, true ) ) {
+                        // Only bash through floor if it doesn't exist
+                        // Bash the current tile's floor, not the one's below
+                        here.bash( pt, bash_force, true, false, true );
+                    }
+                    scratch.mark_obstacle_dirty( dest );
+                }
 
-            if( dist_map.count( dest ) == 0 || dist_map[dest] > next_dist ) {
-                open.emplace( next_dist, dest );
-                dist_map[dest] = next_dist;
+                float next_dist = distance;
+                next_dist += ( x_offset[i] == 0 || y_offset[i] == 0 ) ? tile_dist : diag_dist;
+                if( z_offset[i] != 0 ) {
+                    if( !here.valid_move( pt, dest, false, true ) ) {
+                        continue;
+                    }
+
+                    next_dist += zlev_dist;
+                }
+
+                if( neighbor.dist > next_dist ) {
+                    neighbor.dist = next_dist;
+                    scratch.push_open( next_dist, dest );
+                }
             }
         }
+        scratch.open_buckets[bucket].clear();
     }
 
     // Draw the explosion
     std::map<tripoint, nc_color> explosion_colors;
-    for( const tripoint &pt : closed ) {
+    for( const tripoint &pt : scratch.blasted ) {
         if( here.impassable( pt ) ) {
             continue;
         }
 
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+        const float force = power * std::pow( distance_factor, scratch.cell( pt ).dist );
         nc_color col = c_red;
         if( force < 10 ) {
             col = c_white;
@@ -286,8 +425,8 @@ static void do_blast( const Creature *source, const tripoint &p, const float pow
 
     creature_tracker &creatures = get_creature_tracker();
     Creature *mutable_source = source == nullptr ? nullptr : creatures.creature_at( source->pos() );
-    for( const tripoint &pt : closed ) {
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+    for( const tripoint &pt : scratch.blasted ) {
+        const float force = power * std::pow( distance_factor, scratch.cell( pt ).dist );
         if( force < 1.0f ) {
             // Too weak to matter
             continue;
@@ -370,7 +509,8 @@ static void do_blast( const Creature *source, const tripoint &p, const float pow
     }
 }
 
-static std::vector<tripoint> shrapnel( const Creature *source, const tripoint &src, int power,
+static std::vector<tripoint> shrapnel( explosion_scratch &scratch, const Creature *source,
+                                       const tripoint &src, int power,
                                        int casing_mass, float per_fragment_mass, int range = -1 )
 {
     // The gurney equation wants the total mass of the casing.
@@ -387,22 +527,14 @@ static std::vector<tripoint> shrapnel( const Creature *source, const tripoint &s
     proj.range = range;
     proj.proj_effects.insert( "NULL_SOURCE" );
 
-    struct local_caches {
-        cata::mdarray<fragment_cloud, point_bub_ms> obstacle_cache;
-        cata::mdarray<fragment_cloud, point_bub_ms> visited_cache;
-    };
-
-    std::unique_ptr<local_caches> caches = std::make_unique<local_caches>();
-    cata::mdarray<fragment_cloud, point_bub_ms> &obstacle_cache = caches->obstacle_cache;
-    cata::mdarray<fragment_cloud, point_bub_ms> &visited_cache = caches->visited_cache;
-
     map &here = get_map();
     // TODO: Calculate range based on max effective range for projectiles.
     // Basically bisect between 0 and map diameter using shrapnel_calc().
     // Need to update shadowcasting to support limiting range without adjusting initial distance.
     const tripoint_range<tripoint> area = here.points_on_zlevel( src.z );
 
-    here.build_obstacle_cache( area.min(), area.max() + tripoint_south_east, obstacle_cache );
+    const obstacle_cache_t &obstacle_cache = scratch.obstacle_cache( here, src.z );
+    obstacle_cache_t &visited_cache = scratch.clean_visited_cache();
 
     // Shadowcasting normally ignores the origin square,
     // so apply it manually to catch monsters standing on the explosive.
@@ -415,16 +547,20 @@ static std::vector<tripoint> shrapnel( const Creature *source, const tripoint &s
                  update_fragment_cloud, accumulate_fragment_cloud>
                  ( visited_cache, obstacle_cache, src.xy(), 0, initial_cloud );
 
+    // Collect the tiles fragments reached in one flat pass over the cache first,
+    // so the creature and terrain lookups below only run for tiles that were actually hit.
+    for( const tripoint &target : area ) {
+        const fragment_cloud &cloud = visited_cache[target.x][target.y];
+        if( cloud.density > MIN_FRAGMENT_DENSITY && cloud.velocity > MIN_EFFECTIVE_VELOCITY ) {
+            distrib.emplace_back( target );
+        }
+    }
+
     creature_tracker &creatures = get_creature_tracker();
     Creature *mutable_source = source == nullptr ? nullptr : creatures.creature_at( source->pos() );
     // Now visited_caches are populated with density and velocity of fragments.
-    for( const tripoint &target : area ) {
+    for( const tripoint &target : distrib ) {
         fragment_cloud &cloud = visited_cache[target.x][target.y];
-        if( cloud.density <= MIN_FRAGMENT_DENSITY ||
-            cloud.velocity <= MIN_EFFECTIVE_VELOCITY ) {
-            continue;
-        }
-        distrib.emplace_back( target );
         int damage = ballistic_damage( cloud.velocity, fragment_mass );
         Creature *critter = creatures.creature_at( target );
         if( damage > 0 && critter && !critter->is_dead_state() ) {
@@ -468,6 +604,7 @@ static std::vector<tripoint> shrapnel( const Creature *source, const tripoint &s
             } else {
                 here.bash( target, damage / 100, true );
             }
+            scratch.mark_obstacle_dirty( target );
         }
     }
 
@@ -491,7 +628,8 @@ void explosion( const Creature *source, const tripoint &p, const explosion_data
     _explosions.emplace_back( source, get_map().getglobal( p ), ex );
 }
 
-void _make_explosion( const Creature *source, const tripoint &p, const explosion_data &ex )
+static void make_explosion( explosion_scratch &scratch, const Creature *source, const tripoint &p,
+                            const explosion_data &ex )
 {
     int noise = ex.power * ( ex.fire ? 2 : 10 );
     noise = ( noise > ex.max_noise ) ? ex.max_noise : noise;
@@ -510,13 +648,14 @@ void _make_explosion( const Creature *source, const tripoint &p, const explosion
     } else if( ex.distance_factor > 0.0f && ex.power > 0.0f ) {
         // Power rescaled to mean grams of TNT equivalent, this scales it roughly back to where
         // it was before until we re-do blasting power to be based on TNT-equivalent directly.
-        do_blast( source, p, ex.power / 15.0, ex.distance_factor, ex.fire );
+        do_blast( scratch, source, p, ex.power / 15.0, ex.distance_factor, ex.fire );
     }
 
     map &here = get_map();
     const shrapnel_data &shr = ex.shrapnel;
     if( shr.casing_mass > 0 ) {
-        auto shrapnel_locations = shrapnel( source, p, ex.power, shr.casing_mass, shr.fragment_mass );
+        auto shrapnel_locations = shrapnel( scratch, source, p, ex.power, shr.casing_mass,
+                                            shr.fragment_mass );
 
         // If explosion drops shrapnel...
         if( shr.recovery > 0 && !shr.drop.is_null() ) {
@@ -542,6 +681,13 @@ void _make_explosion( const Creature *source, const tripoint &p, const explosion
     }
 }
 
+void _make_explosion( const Creature *source, const tripoint &p, const explosion_data &ex )
+{
+    explosion_scratch &scratch = get_explosion_scratch();
+    scratch.begin_batch();
+    make_explosion( scratch, source, p, ex );
+}
+
 void flashbang( const tripoint &p, bool player_immune )
 {
     draw_explosion( p, 8, c_white );
@@ -893,15 +1039,26 @@ void resonance_cascade( const tripoint &p )
 
 void process_explosions()
 {
-    for( const queued_explosion &ex : _explosions ) {
-        const tripoint p = get_map().getlocal( ex.pos );
-        if( p.x < 0 || p.x >= MAPSIZE_X || p.y < 0 || p.y >= MAPSIZE_Y ) {
-            debugmsg( "Explosion origin (%d, %d, %d) is out-of-bounds", p.x, p.y, p.z );
-            continue;
+    if( _explosions.empty() ) {
+        return;
+    }
+    explosion_scratch &scratch = get_explosion_scratch();
+    scratch.begin_batch();
+    // Explosions can set off further explosions, which get queued while we process this batch.
+    // Keep going until the chain reaction burns out, so they can all share the scratch state.
+    std::vector<queued_explosion> batch;
+    while( !_explosions.empty() ) {
+        batch.clear();
+        std::swap( batch, _explosions );
+        for( const queued_explosion &ex : batch ) {
+            const tripoint p = get_map().getlocal( ex.pos );
+            if( p.x < 0 || p.x >= MAPSIZE_X || p.y < 0 || p.y >= MAPSIZE_Y ) {
+                debugmsg( "Explosion origin (%d, %d, %d) is out-of-bounds", p.x, p.y, p.z );
+                continue;
+            }
+            make_explosion( scratch, ex.source, p, ex.data );
         }
-        _make_explosion( ex.source, p, ex.data );
     }
-    _explosions.clear();
 }
 
 } // namespace explosion_handler
@@ -0,0 +1,235 @@
+#pragma once
+#ifndef CATA_SRC_FLAT_MAP_H
+#define CATA_SRC_FLAT_MAP_H
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "flat_set.h"
+
+namespace cata
+{
+
+/**
+ * @brief An associative container mapping unique keys to values, implemented as a sorted vector
+ * of key/value pairs.
+ *
+ * O(n) insertion, O(log(n)) lookup, only one allocation at any given time.  Meant for the many
+ * small maps copied along with game objects, e.g. item variables.
+ * Unlike std::map, iterators and references are invalidated by insertion and erasure and the
+ * keys are not const, so they must not be modified through an iterator.
+ */
+template<typename Key, typename T, typename Compare = transparent_less_than>
+class flat_map : private Compare
+{
+    private:
+        template<typename Cmp, typename Sfinae, typename = void>
+        struct has_is_transparent {};
+        template<typename Cmp, typename Sfinae>
+        struct has_is_transparent<Cmp, Sfinae, typename Cmp::is_transparent> {
+            using type = void;
+        };
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key, T>;
+        using key_compare = Compare;
+
+    private:
+        using Data = std::vector<value_type>;
+
+    public:
+        using size_type = typename Data::size_type;
+        using difference_type = typename Data::difference_type;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = typename Data::iterator;
+        using const_iterator = typename Data::const_iterator;
+
+        flat_map() = default;
+        template<typename InputIt>
+        flat_map( InputIt first, InputIt last ) : data( first, last ) {
+            sort_data();
+        }
+        flat_map( std::initializer_list<value_type> init ) : data( init ) {
+            sort_data();
+        }
+
+        const key_compare &key_comp() const {
+            return *this;
+        }
+
+        size_type size() const {
+            return data.size();
+        }
+        bool empty() const {
+            return data.empty();
+        }
+        void clear() {
+            data.clear();
+        }
+        void reserve( size_type n ) {
+            data.reserve( n );
+        }
+
+        iterator begin() {
+            return data.begin();
+        }
+        iterator end() {
+            return data.end();
+        }
+        const_iterator begin() const {
+            return data.begin();
+        }
+        const_iterator end() const {
+            return data.end();
+        }
+        const_iterator cbegin() const {
+            return data.cbegin();
+        }
+        const_iterator cend() const {
+            return data.cend();
+        }
+
+        iterator lower_bound( const Key &k ) {
+            return std::lower_bound( begin(), end(), k, key_less() );
+        }
+        const_iterator lower_bound( const Key &k ) const {
+            return std::lower_bound( begin(), end(), k, key_less() );
+        }
+        template<typename K, typename = typename has_is_transparent<Compare, K>::type>
+        iterator lower_bound( const K &k ) {
+            return std::lower_bound( begin(), end(), k, key_less() );
+        }
+        template<typename K, typename = typename has_is_transparent<Compare, K>::type>
+        const_iterator lower_bound( const K &k ) const {
+            return std::lower_bound( begin(), end(), k, key_less() );
+        }
+
+        iterator find( const Key &k ) {
+            return find_impl( *this, k );
+        }
+        const_iterator find( const Key &k ) const {
+            return find_impl( *this, k );
+        }
+        template<typename K, typename = typename has_is_transparent<Compare, K>::type>
+        iterator find( const K &k ) {
+            return find_impl( *this, k );
+        }
+        template<typename K, typename = typename has_is_transparent<Compare, K>::type>
+        const_iterator find( const K &k ) const {
+            return find_impl( *this, k );
+        }
+        size_type count( const Key &k ) const {
+            return find( k ) != end();
+        }
+        template<typename K, typename = typename has_is_transparent<Compare, K>::type>
+        size_type count( const K &k ) const {
+            return find( k ) != end();
+        }
+
+        T &operator[]( const Key &k ) {
+            return try_emplace( k ).first->second;
+        }
+        T &operator[]( Key &&k ) {
+            return try_emplace( std::move( k ) ).first->second;
+        }
+
+        template<typename K, typename... Args>
+        std::pair<iterator, bool> try_emplace( K &&k, Args &&... args ) {
+            auto at = lower_bound( k );
+            if( at != end() && !key_comp()( k, at->first ) ) {
+                return { at, false };
+            }
+            at = data.emplace( at, std::piecewise_construct,
+                               std::forward_as_tuple( std::forward<K>( k ) ),
+                               std::forward_as_tuple( std::forward<Args>( args )... ) );
+            return { at, true };
+        }
+        std::pair<iterator, bool> insert( const value_type &value ) {
+            return try_emplace( value.first, value.second );
+        }
+        std::pair<iterator, bool> insert( value_type &&value ) {
+            return try_emplace( std::move( value.first ), std::move( value.second ) );
+        }
+        template<typename InputIt>
+        void insert( InputIt first, InputIt last ) {
+            /// TODO: could be faster when inserting only a few elements
+            data.insert( data.end(), first, last );
+            sort_data();
+        }
+
+        iterator erase( const_iterator pos ) {
+            return data.erase( pos );
+        }
+        iterator erase( const_iterator first, const_iterator last ) {
+            return data.erase( first, last );
+        }
+        size_type erase( const Key &k ) {
+            auto at = find( k );
+            if( at != end() ) {
+                erase( at );
+                return 1;
+            }
+            return 0;
+        }
+
+        friend void swap( flat_map &l, flat_map &r ) {
+            using std::swap;
+            swap( static_cast<Compare &>( l ), static_cast<Compare &>( r ) );
+            swap( l.data, r.data );
+        }
+#define FLAT_MAP_OPERATOR( op ) \
+    friend bool operator op( const flat_map &l, const flat_map &r ) { \
+        return l.data op r.data; \
+    }
+        FLAT_MAP_OPERATOR( == )
+        FLAT_MAP_OPERATOR( != )
+        FLAT_MAP_OPERATOR( < )
+        FLAT_MAP_OPERATOR( <= )
+        FLAT_MAP_OPERATOR( > )
+        FLAT_MAP_OPERATOR( >= )
+#undef FLAT_MAP_OPERATOR
+    private:
+        // Compares the key of an element against a bare key.
+        struct key_less_t {
+            const Compare &comp;
+            template<typename K>
+            bool operator()( const value_type &v, const K &k ) const {
+                return comp( v.first, k );
+            }
+        };
+        key_less_t key_less() const {
+            return key_less_t{ key_comp() };
+        }
+        template<typename Self, typename K>
+        static auto find_impl( Self &self, const K &k ) -> decltype( self.begin() ) {
+            auto at = self.lower_bound( k );
+            if( at != self.end() && !self.key_comp()( k, at->first ) ) {
+                return at;
+            }
+            return self.end();
+        }
+        void sort_data() {
+            // Stable, so that of several elements with the same key the first one is kept,
+            // like when inserting them one by one into a std::map.
+            std::stable_sort( data.begin(), data.end(),
+            [this]( const value_type & l, const value_type & r ) {
+                return key_comp()( l.first, r.first );
+            } );
+            auto new_end = std::unique( data.begin(), data.end(),
+            [this]( const value_type & l, const value_type & r ) {
+                return !key_comp()( l.first, r.first ) && !key_comp()( r.first, l.first );
+            } );
+            data.erase( new_end, data.end() );
+        }
+
+        Data data;
+};
+
+} // namespace cata
+
+#endif // CATA_SRC_FLAT_MAP_H
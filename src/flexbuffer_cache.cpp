@@ -21,6 +21,7 @@
 #include "make_static.h"
 #include "mmap_file.h"
 #include "path_info.h"
+#include "save_writer.h"
 
 namespace
 {
@@ -49,7 +50,8 @@ std::vector<uint8_t> parse_json_to_flexbuffer_(
     opts.use_flexbuffers = true;
     opts.no_warnings = true;
     flatbuffers::Parser parser{ opts };
-    flexbuffers::Builder fbb;
+    // Saves repeat the same ids over and over, store each string once
+    flexbuffers::Builder fbb( 256, flexbuffers::BUILDER_FLAG_SHARE_KEYS_AND_STRINGS );
 
     if( !parser.ParseFlexBuffer( buffer, source_filename_opt, &fbb ) ) {
         std::istringstream is{ buffer };
@@ -112,6 +114,34 @@ std::vector<uint8_t> parse_json_to_flexbuffer_(
     return std::move( fbb ).GetBuffer();
 }
 
+// Parses the json file straight from its mapping when possible, instead of reading it into memory
+// first. The parser reads up to a terminating NUL, which a mapped file only has when it does not
+// fill its last page, as the rest of that page is zeroed. Pages are a multiple of 4 KiB everywhere.
+// Files that fill their last page and compressed files are read into memory instead.
+std::vector<uint8_t> parse_json_file_to_flexbuffer_( const fs::path &json_source_path,
+        size_t offset ) noexcept( false )
+{
+    constexpr size_t min_page_size = 4096;
+    const std::string json_source_path_string = json_source_path.generic_u8string();
+    save_writer::flush();
+    std::shared_ptr<mmap_file> json_source = mmap_file::map_file( json_source_path );
+    const bool gzipped = json_source && json_source->len >= 2 &&
+                         json_source->base[0] == 0x1f && json_source->base[1] == 0x8b;
+    if( json_source && !gzipped && json_source->len > offset &&
+        json_source->len % min_page_size != 0 ) {
+        const char *json_text = reinterpret_cast<const char *>( json_source->base ) + offset;
+        return parse_json_to_flexbuffer_( json_text, json_source_path_string.c_str() );
+    }
+    json_source.reset();
+
+    std::optional<std::string> json_file_contents = read_whole_file( json_source_path );
+    if( !json_file_contents.has_value() || json_file_contents->empty() ) {
+        throw std::runtime_error( "Failed to read " + json_source_path_string );
+    }
+    const char *json_text = json_file_contents->c_str() + offset;
+    return parse_json_to_flexbuffer_( json_text, json_source_path_string.c_str() );
+}
+
 } // namespace
 
 struct flexbuffer_vector_storage : flexbuffer_storage {
@@ -382,15 +412,7 @@ flexbuffer_cache::~flexbuffer_cache() = default;
 std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse( fs::path json_source_path,
         size_t offset )
 {
-    std::string json_source_path_string = json_source_path.generic_u8string();
-    std::shared_ptr<mmap_file> json_source = mmap_file::map_file( json_source_path );
-    if( !json_source ) {
-        throw std::runtime_error( "Failed to mmap " + json_source_path_string );
-    }
-
-    const char *json_text = reinterpret_cast<const char *>( json_source->base ) + offset;
-
-    std::vector<uint8_t> fb = parse_json_to_flexbuffer_( json_text, json_source_path_string.c_str() );
+    std::vector<uint8_t> fb = parse_json_file_to_flexbuffer_( json_source_path, offset );
 
     auto storage = std::make_shared<flexbuffer_vector_storage>( std::move( fb ) );
 
@@ -425,16 +447,8 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_and_cache(
         }
     }
 
-    std::string json_source_path_string = lexically_normal_json_source_path.generic_u8string();
-    std::optional<std::string> json_file_contents = read_whole_file(
-                lexically_normal_json_source_path );
-    if( !json_file_contents.has_value() || json_file_contents->empty() ) {
-        throw std::runtime_error( "Failed to read " + json_source_path_string );
-    }
-    std::string &json_source = *json_file_contents;
-
-    const char *json_text = reinterpret_cast<const char *>( json_source.c_str() ) + offset;
-    std::vector<uint8_t> fb = parse_json_to_flexbuffer_( json_text, json_source_path_string.c_str() );
+    std::vector<uint8_t> fb = parse_json_file_to_flexbuffer_( lexically_normal_json_source_path,
+                              offset );
 
     if( disk_cache_ ) {
         disk_cache_->save_to_disk( lexically_normal_json_source_path, fb );
@@ -96,6 +96,7 @@
 #include "iexamine.h"
 #include "init.h"
 #include "input.h"
+#include "interned_flag.h"
 #include "inventory.h"
 #include "item.h"
 #include "item_category.h"
@@ -155,6 +156,7 @@
 #include "ret_val.h"
 #include "rng.h"
 #include "safemode_ui.h"
+#include "save_writer.h"
 #include "scenario.h"
 #include "scent_map.h"
 #include "scores_ui.h"
@@ -250,6 +252,8 @@ static const harvest_drop_type_id harvest_drop_blood( "blood" );
 static const harvest_drop_type_id harvest_drop_offal( "offal" );
 static const harvest_drop_type_id harvest_drop_skin( "skin" );
 
+static const interned_flag flag_BRIDGE( "BRIDGE" );
+
 static const itype_id fuel_type_animal( "animal" );
 static const itype_id itype_battery( "battery" );
 static const itype_id itype_disassembly( "disassembly" );
@@ -2938,6 +2942,7 @@ void game::move_save_to_graveyard()
         debugmsg( "could not create graveyard path '%s'", graveyard_dir );
     }
 
+    save_writer::flush();
     const auto save_files = get_files_from_path( prefix, save_dir );
     if( save_files.empty() ) {
         debugmsg( "could not find save files in '%s'", save_dir );
@@ -3253,7 +3258,7 @@ void game::reset_npc_dispositions()
 bool game::save_factions_missions_npcs()
 {
     std::string masterfile = PATH_INFO::world_base_save_path() + "/" + SAVE_MASTER;
-    return write_to_file( masterfile, [&]( std::ostream & fout ) {
+    return save_writer::write_to_file( masterfile, [&]( std::ostream & fout ) {
         serialize_master( fout );
     }, _( "factions data" ) );
 }
@@ -3275,7 +3280,8 @@ bool game::save_player_data()
 {
     const std::string playerfile = PATH_INFO::player_base_save_path();
 
-    const bool saved_data = write_to_file( playerfile + SAVE_EXTENSION, [&]( std::ostream & fout ) {
+    const bool saved_data = save_writer::write_to_file( playerfile + SAVE_EXTENSION, [&](
+    std::ostream & fout ) {
         serialize( fout );
     }, _( "player data" ) );
     const bool saved_map_memory = u.save_map_memory();
@@ -3347,13 +3353,15 @@ spell_events &game::spell_events_subscriber()
     return *spell_events_ptr;
 }
 
-bool game::save()
+bool game::save( const bool in_background )
 {
     std::chrono::seconds time_since_load =
         std::chrono::duration_cast<std::chrono::seconds>(
             std::chrono::steady_clock::now() - time_of_last_load );
     std::chrono::seconds total_time_played = time_played_at_last_load + time_since_load;
     events().send<event_type::game_save>( time_since_load, total_time_played );
+    // Report failures of the previous save, its files are still written in the background
+    save_writer::wait();
     try {
         if( !save_player_data() ||
             !save_factions_missions_npcs() ||
@@ -3362,22 +3370,27 @@ bool game::save()
             !get_auto_notes_settings().save( true ) ||
             !get_safemode().save_character() ||
             !zone_manager::get_manager().save_zones() ||
-        !write_to_file( PATH_INFO::world_base_save_path() + "/uistate.json", [&]( std::ostream & fout ) {
+        !save_writer::write_to_file( PATH_INFO::world_base_save_path() + "/uistate.json", [&](
+        std::ostream & fout ) {
         JsonOut jsout( fout );
             uistate.serialize( jsout );
         }, _( "uistate data" ) ) ) {
             debugmsg( "game not saved" );
             return false;
         } else {
-            world_generator->last_world_name = world_generator->active_world->world_name;
-            world_generator->last_character_name = u.name;
-            world_generator->save_last_world_info();
-            world_generator->active_world->add_save( save_t::from_save_id( u.get_save_id() ) );
-            write_to_file( PATH_INFO::world_base_save_path_path() / ( base64_encode(
+            save_writer::write_to_file( PATH_INFO::world_base_save_path_path() / ( base64_encode(
             u.get_save_id() ) + ".pt" ), [&total_time_played]( std::ostream & fout ) {
                 fout.imbue( std::locale::classic() );
                 fout << total_time_played.count();
             } );
+            // wait() already told the user which files failed
+            if( !in_background && !save_writer::wait() ) {
+                return false;
+            }
+            world_generator->last_world_name = world_generator->active_world->world_name;
+            world_generator->last_character_name = u.name;
+            world_generator->save_last_world_info();
+            world_generator->active_world->add_save( save_t::from_save_id( u.get_save_id() ) );
             return true;
         }
     } catch( std::ios::failure & ) {
@@ -10768,7 +10781,7 @@ point game::place_player( const tripoint &dest_loc, bool quick )
     }
     // Drench the player if swimmable
     if( m.has_flag( ter_furn_flag::TFLAG_SWIMMABLE, u.pos() ) &&
-        !m.has_flag_furn( "BRIDGE", u.pos() ) &&
+        !m.has_flag_furn( flag_BRIDGE, u.pos() ) &&
         !( u.is_mounted() || ( u.in_vehicle && vp1->vehicle().can_float() ) ) ) {
         u.drench( 80, u.get_drenching_body_parts( false, false ),
                   false );
@@ -12660,7 +12673,7 @@ void game::init_autosave()
     last_save_timestamp = std::time( nullptr );
 }
 
-void game::quicksave()
+void game::quicksave( const bool in_background )
 {
     //Don't autosave if the player hasn't done anything since the last autosave/quicksave,
     if( !moves_since_last_save ) {
@@ -12676,7 +12689,7 @@ void game::quicksave()
     time_t now = std::time( nullptr ); //timestamp for start of saving procedure
 
     //perform save
-    save();
+    save( in_background );
     //Now reset counters for autosaving, so we don't immediately autosave after a quicksave or autosave.
     moves_since_last_save = 0;
     last_save_timestamp = now;
@@ -12715,7 +12728,7 @@ void game::autosave()
     if( std::time( nullptr ) < last_save_timestamp + 60 * get_option<int>( "AUTOSAVE_MINUTES" ) ) {
         return;
     }
-    quicksave();    //Driving checks are handled by quicksave()
+    quicksave( true );    //Driving checks are handled by quicksave()
 }
 
 void game::start_calendar()
@@ -210,8 +210,12 @@ class game
         void unserialize_master( const cata_path &file_name, std::istream &fin ); // for load
         void unserialize_master( const JsonValue &jv ); // for load
 
-        /** Returns false if saving failed. */
-        bool save();
+        /**
+         * Returns false if saving failed.
+         * @param in_background Return once everything is queued instead of waiting for the files
+         * to be written, for autosaves. Write errors are then reported by the next save.
+         */
+        bool save( bool in_background = false );
 
         /** Returns a list of currently active character saves. */
         std::vector<std::string> list_active_saves();
@@ -989,7 +993,7 @@ class game
         //  int autosave_timeout();  // If autosave enabled, how long we should wait for user inaction before saving.
         void autosave();         // automatic quicksaves - Performs some checks before calling quicksave()
     public:
-        void quicksave();        // Saves the game without quitting
+        void quicksave( bool in_background = false ); // Saves the game without quitting
         void quickload();        // Loads the previously saved game if it exists
         void disp_NPCs();        // Currently for debug use.  Lists global NPCs.
 
@@ -1038,7 +1038,7 @@ class activatable_inventory_preset : public pickup_inventory_preset
 {
     public:
         explicit activatable_inventory_preset( const Character &you ) : pickup_inventory_preset( you ),
-            you( you ) {
+            you( you ), item_scope( you ) {
             _collate_entries = true;
             if( get_option<bool>( "INV_USE_ACTION_NAMES" ) ) {
                 append_cell( [ this ]( const item_location & loc ) {
@@ -1138,6 +1138,9 @@ class activatable_inventory_preset : public pickup_inventory_preset
 
     private:
         const Character &you;
+        // The checks of every listed item ask about the tools carried, which don't change while
+        // the menu is open.
+        Character::item_index_scope item_scope;
 };
 
 item_location game_menus::inv::use( avatar &you )
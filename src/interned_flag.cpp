@@ -0,0 +1,53 @@
+#include "interned_flag.h"
+
+#include <unordered_map>
+
+namespace
+{
+
+struct interned_flag_registry {
+    std::unordered_map<std::string, size_t> indices;
+    std::vector<const std::string *> strings;
+
+    size_t intern( const std::string &flag ) {
+        const auto inserted = indices.emplace( flag, strings.size() );
+        if( inserted.second ) {
+            // Keys of an unordered_map do not move when it grows
+            strings.push_back( &inserted.first->first );
+        }
+        return inserted.first->second;
+    }
+};
+
+interned_flag_registry &get_registry()
+{
+    static interned_flag_registry registry;
+    return registry;
+}
+
+} // namespace
+
+interned_flag::interned_flag( const std::string &flag ) : index_( get_registry().intern( flag ) )
+{
+}
+
+const std::string &interned_flag::str() const
+{
+    return *get_registry().strings[index_];
+}
+
+void interned_flag_set::assign( const std::set<std::string> &flags )
+{
+    bits.clear();
+    for( const std::string &flag : flags ) {
+        set( interned_flag( flag ) );
+    }
+}
+
+void interned_flag_set::set( const interned_flag &flag )
+{
+    if( flag.index() >= bits.size() ) {
+        bits.resize( flag.index() + 1 );
+    }
+    bits[flag.index()] = true;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#ifndef CATA_SRC_INTERNED_FLAG_H
+#define CATA_SRC_INTERNED_FLAG_H
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * A string flag interned to a small index, for checking the JSON flags of terrain, furniture
+ * and vehicle parts without looking the string up in their flag sets.
+ * Indices are handed out in order by a registry that never forgets a string, so a handle stays
+ * valid across data reloads. Handles are meant to be created once, as static constants:
+ *
+ *     static const interned_flag flag_POWER_TRANSFER( "POWER_TRANSFER" );
+ *     vpi.has_flag( flag_POWER_TRANSFER );
+ */
+class interned_flag
+{
+    public:
+        explicit interned_flag( const std::string &flag );
+
+        size_t index() const {
+            return index_;
+        }
+        const std::string &str() const;
+
+    private:
+        size_t index_;
+};
+
+/**
+ * The flags of one type as bits indexed by @ref interned_flag::index.
+ * Flags interned after the set was assigned are past its end, and no type has them.
+ */
+class interned_flag_set
+{
+    public:
+        /** Interns all the flags and replaces the contents of the set with them. */
+        void assign( const std::set<std::string> &flags );
+        void set( const interned_flag &flag );
+
+        bool has( const interned_flag &flag ) const {
+            return flag.index() < bits.size() && bits[flag.index()];
+        }
+
+    private:
+        std::vector<bool> bits;
+};
+
+#endif // CATA_SRC_INTERNED_FLAG_H
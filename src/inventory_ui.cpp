@@ -81,6 +81,9 @@ using item_name_t = std::pair<std::string, std::string>;
 using name_cache_t = std::unordered_map<item const *, item_name_t>;
 name_cache_t item_name_cache;
 int item_name_cache_users = 0;
+// Filtering and the item info shown by the menus ask for names and info of the listed items
+// again and again, keep them while any menu is open.
+std::optional<item::display_cache_scope> item_display_cache_scope;
 
 item_name_t &get_cached_name( item const *it )
 {
@@ -1181,6 +1184,7 @@ void inventory_column::set_stack_favorite( inventory_entry &entry,
     for( item_location &loc : entry.locations ) {
         loc->set_favorite( favorite );
     }
+    item::invalidate_display_cache();
     entry.make_entry_cell_cache( preset );
 }
 
@@ -1202,6 +1206,7 @@ void inventory_column::set_collapsed( inventory_entry &entry, const bool collaps
     }
 
     if( collapsed ) {
+        item::invalidate_display_cache();
         entry.collapsed = collapse;
         paging_is_valid = false;
         entry.make_entry_cell_cache( preset );
@@ -2111,6 +2116,8 @@ void inventory_selector::add_remote_map_items( tinymap *remote_map, const tripoi
 
 void inventory_selector::clear_items()
 {
+    // The items are about to be added again, possibly changed
+    item::invalidate_display_cache();
     is_empty = true;
     for( inventory_column *&column : columns ) {
         column->clear();
@@ -2754,7 +2761,9 @@ inventory_selector::inventory_selector( Character &u, const inventory_selector_p
     , _uimode( preset.save_state == nullptr ? inventory_sel_default_state.uimode :
                preset.save_state->uimode )
 {
-    item_name_cache_users++;
+    if( item_name_cache_users++ == 0 ) {
+        item_display_cache_scope.emplace();
+    }
     tp_start =
         std::chrono::time_point_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() );
     ctxt.register_action( "COORDINATE" );
@@ -2802,6 +2811,7 @@ inventory_selector::~inventory_selector()
     item_name_cache_users--;
     if( item_name_cache_users <= 0 ) {
         item_name_cache.clear();
+        item_display_cache_scope.reset();
     }
     if( preset.save_state == nullptr ) {
         inventory_sel_default_state.uimode = _uimode;
@@ -16,6 +16,7 @@
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -99,6 +100,7 @@
 #include "string_formatter.h"
 #include "string_id.h"
 #include "string_id_utils.h"
+#include "temperature_history.h"
 #include "text_snippets.h"
 #include "translations.h"
 #include "try_parse_integer.h"
@@ -291,7 +293,7 @@ item::item( const itype *type, time_point turn, int qty ) : type( type ), bday(
     if( type->countdown_interval > 0_seconds ) {
         countdown_point = calendar::turn + type->countdown_interval;
     }
-    item_vars = type->item_variables;
+    item_vars = VarsMapType( type->item_variables.begin(), type->item_variables.end() );
 
     if( has_flag( flag_CORPSE ) ) {
         corpse = &type->source_monster.obj();
@@ -1736,6 +1738,75 @@ static int get_ranged_pierce( const common_ranged_data &ranged )
     return ranged.damage.damage_units.front().res_pen;
 }
 
+namespace
+{
+
+/** The names and info kept by @ref item::display_cache_scope. */
+struct item_display_cache {
+    using tname_args = std::tuple<unsigned int, bool, unsigned int, bool, bool, bool>;
+    struct info_entry {
+        iteminfo_query parts;
+        int batch;
+        std::vector<iteminfo> info;
+        std::string text;
+    };
+    /**
+     * What most often changes about an item, or tells apart the different items that lived at
+     * the same address, such as temporary copies.
+     */
+    using item_state = std::tuple<const itype *, int, int, int, int, bool, size_t>;
+    struct entry {
+        item_state state;
+        std::vector<std::pair<tname_args, std::string>> names;
+        std::vector<std::pair<unsigned int, std::string>> display_names;
+        std::vector<info_entry> infos;
+    };
+
+    int scopes = 0;
+    int lang_version = INVALID_LANGUAGE_VERSION;
+    std::unordered_map<const item *, entry> items;
+
+    /** What is kept for the item, or nullptr when there is no scope open. */
+    entry *find( const item &it ) {
+        if( scopes == 0 ) {
+            return nullptr;
+        }
+        if( lang_version != detail::get_current_language_version() ) {
+            items.clear();
+            lang_version = detail::get_current_language_version();
+        }
+        const item_state state( it.type, it.charges, it.damage(), it.degradation(), it.burnt,
+                                it.is_favorite, it.num_item_stacks() );
+        entry &e = items[&it];
+        if( e.state != state ) {
+            e = entry();
+            e.state = state;
+        }
+        return &e;
+    }
+};
+
+item_display_cache display_cache;
+
+} // namespace
+
+item::display_cache_scope::display_cache_scope()
+{
+    display_cache.scopes++;
+}
+
+item::display_cache_scope::~display_cache_scope()
+{
+    if( --display_cache.scopes == 0 ) {
+        display_cache.items.clear();
+    }
+}
+
+void item::invalidate_display_cache()
+{
+    display_cache.items.clear();
+}
+
 std::string item::info( bool showtext ) const
 {
     std::vector<iteminfo> dummy;
@@ -2199,8 +2270,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
 
     if( parts->test( iteminfo_parts::DESCRIPTION ) ) {
         insert_separation_line( info );
-        const std::map<std::string, std::string>::const_iterator idescription =
-            item_vars.find( "description" );
+        const VarsMapType::const_iterator idescription = item_vars.find( "description" );
         const std::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
         if( snippet.has_value() ) {
             // Just use the dynamic description
@@ -5636,13 +5706,12 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         }
     }
 
-    std::map<std::string, std::string>::const_iterator item_note = item_vars.find( "item_note" );
+    VarsMapType::const_iterator item_note = item_vars.find( "item_note" );
 
     if( item_note != item_vars.end() && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
         insert_separation_line( info );
         std::string ntext;
-        std::map<std::string, std::string>::const_iterator item_note_tool =
-            item_vars.find( "item_note_tool" );
+        VarsMapType::const_iterator item_note_tool = item_vars.find( "item_note_tool" );
         const use_function *use_func =
             item_note_tool != item_vars.end() ?
             item_controller->find_template(
@@ -5792,11 +5861,28 @@ void item::ascii_art_info( std::vector<iteminfo> &info, const iteminfo_query * /
 
 std::string item::info( std::vector<iteminfo> &info, const iteminfo_query *parts, int batch ) const
 {
-    const bool debug = g != nullptr && debug_mode;
-
     if( parts == nullptr ) {
         parts = &iteminfo_query::all;
     }
+    item_display_cache::entry *const cached = display_cache.find( *this );
+    if( cached == nullptr ) {
+        return build_info( info, parts, batch );
+    }
+    for( const item_display_cache::info_entry &e : cached->infos ) {
+        if( e.batch == batch && e.parts == *parts ) {
+            info = e.info;
+            return e.text;
+        }
+    }
+    std::string text = build_info( info, parts, batch );
+    cached->infos.push_back( { *parts, batch, info, text } );
+    return text;
+}
+
+std::string item::build_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
+                              int batch ) const
+{
+    const bool debug = g != nullptr && debug_mode;
 
     info.clear();
 
@@ -6307,10 +6393,10 @@ void item::update_inherited_flags()
 {
     inherited_tags_cache.clear();
 
-    auto const inehrit_flags = [this]( FlagsSetType const & Flags ) {
+    auto const inehrit_flags = [this]( auto const & Flags ) {
         for( flag_id const &f : Flags ) {
             if( f->inherit() ) {
-                inherited_tags_cache.emplace( f );
+                inherited_tags_cache.insert( f );
             }
         }
     };
@@ -6389,6 +6475,28 @@ std::string item::degradation_symbol() const
 
 std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int truncate,
                          bool with_contents_full, bool with_collapsed, bool with_contents_abbrev ) const
+{
+    item_display_cache::entry *const cached = display_cache.find( *this );
+    if( cached == nullptr ) {
+        return build_tname( quantity, with_prefix, truncate, with_contents_full, with_collapsed,
+                            with_contents_abbrev );
+    }
+    const item_display_cache::tname_args args{ quantity, with_prefix, truncate, with_contents_full,
+                                               with_collapsed, with_contents_abbrev };
+    for( const std::pair<item_display_cache::tname_args, std::string> &e : cached->names ) {
+        if( e.first == args ) {
+            return e.second;
+        }
+    }
+    std::string name = build_tname( quantity, with_prefix, truncate, with_contents_full,
+                                    with_collapsed, with_contents_abbrev );
+    cached->names.emplace_back( args, name );
+    return name;
+}
+
+std::string item::build_tname( unsigned int quantity, bool with_prefix, unsigned int truncate,
+                               bool with_contents_full, bool with_collapsed,
+                               bool with_contents_abbrev ) const
 {
     // item damage and/or fouling level
     std::string damtext;
@@ -6734,6 +6842,22 @@ std::string item::display_money( unsigned int quantity, unsigned int total,
 }
 
 std::string item::display_name( unsigned int quantity ) const
+{
+    item_display_cache::entry *const cached = display_cache.find( *this );
+    if( cached == nullptr ) {
+        return build_display_name( quantity );
+    }
+    for( const std::pair<unsigned int, std::string> &e : cached->display_names ) {
+        if( e.first == quantity ) {
+            return e.second;
+        }
+    }
+    std::string name = build_display_name( quantity );
+    cached->display_names.emplace_back( quantity, name );
+    return name;
+}
+
+std::string item::build_display_name( unsigned int quantity ) const
 {
     std::string name = tname( quantity );
     std::string sidetxt;
@@ -7739,7 +7863,7 @@ int item::spoilage_sort_order() const
  * Rot maxes out at 105 F
  * Rot stops below 32 F (0C) and above 145 F (63 C)
  */
-float item::calc_hourly_rotpoints_at_temp( const units::temperature &temp ) const
+float item::calc_hourly_rotpoints_at_temp( const units::temperature &temp )
 {
     const units::temperature dropoff = units::from_fahrenheit( 38 ); // F, ~3 C
     const float max_rot_temp = 105; // F, ~41 C, Maximum rotting rate is at this temperature
@@ -7762,19 +7886,18 @@ float item::calc_hourly_rotpoints_at_temp( const units::temperature &temp ) cons
     }
 }
 
-void item::calc_rot( units::temperature temp, const float spoil_modifier,
-                     const time_duration &time_delta )
+float item::rot_multiplier( const float spoil_modifier ) const
 {
     // Avoid needlessly calculating already rotten things.  Corpses should
     // always rot away and food rots away at twice the shelf life.  If the food
     // is in a sealed container they won't rot away, this avoids needlessly
     // calculating their rot in that case.
     if( !is_corpse() && get_relative_rot() > 2.0 ) {
-        return;
+        return 0.0f;
     }
 
     if( has_own_flag( flag_FROZEN ) ) {
-        return;
+        return 0.0f;
     }
 
     // rot modifier
@@ -7785,6 +7908,16 @@ void item::calc_rot( units::temperature temp, const float spoil_modifier,
     if( has_own_flag( flag_MUSHY ) ) {
         factor *= 3.0;
     }
+    return factor;
+}
+
+void item::calc_rot( units::temperature temp, const float spoil_modifier,
+                     const time_duration &time_delta )
+{
+    const float factor = rot_multiplier( spoil_modifier );
+    if( factor == 0.0f ) {
+        return;
+    }
 
     if( has_own_flag( flag_COLD ) ) {
         temp = std::min( temperatures::fridge, temp );
@@ -12294,7 +12427,7 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
         units::temperature_delta temp_mod;
         // Toilets and vending machines will try to get the heat radiation and convection during mapgen and segfault.
         if( !g->new_game ) {
-            temp_mod = get_heat_radiation( pos );
+            temp_mod = here.heat_radiation_at( pos );
             temp_mod += get_convection_temperature( pos );
             temp_mod += here.get_temperature_mod( pos );
         } else {
@@ -12305,6 +12438,29 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
             temp_mod += units::from_fahrenheit_delta( 5 ); // body heat increases inventory temperature
         }
 
+        scoped_temperature_history_cache *history_cache =
+            scoped_temperature_history_cache::active();
+        temperature_history *history = history_cache == nullptr ? nullptr :
+                                       &history_cache->get( pos, flag, temp_mod );
+
+        // Item temperature is only simulated for the last 2 days, so before that rot only depends
+        // on the environment and all those hours can be taken from the shared history at once.
+        const int env_only_hours = to_hours<int>( now - time - 2_days );
+        if( history != nullptr && carrier == nullptr && env_only_hours > 0 ) {
+            if( process_rot ) {
+                const float factor = rot_multiplier( spoil_modifier );
+                const double rot_points = history->rot_points( time, env_only_hours,
+                                          has_own_flag( flag_COLD ) );
+                rot += static_cast<float>( factor * rot_points ) * 1_turns;
+            }
+            time += time_duration::from_hours( env_only_hours );
+            last_temp_check = time;
+            if( process_rot && has_rotten_away() ) {
+                // No need to track item that will be gone
+                return true;
+            }
+        }
+
         // Process the past of this item in 1h chunks until there is less than 1h left.
         time_duration time_delta = 1_hours;
 
@@ -12312,34 +12468,9 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
             time += time_delta;
 
             // Get the environment temperature
-            // Use weather if above ground, use map temp if below
-            units::temperature env_temperature;
-            if( pos.z >= 0 && flag != temperature_flag::ROOT_CELLAR ) {
-                env_temperature = wgen.get_weather_temperature( pos, time, seed );
-            } else {
-                env_temperature = AVERAGE_ANNUAL_TEMPERATURE;
-            }
-            env_temperature += temp_mod;
-
-            switch( flag ) {
-                case temperature_flag::NORMAL:
-                    // Just use the temperature normally
-                    break;
-                case temperature_flag::FRIDGE:
-                    env_temperature = std::min( env_temperature, temperatures::fridge );
-                    break;
-                case temperature_flag::FREEZER:
-                    env_temperature = std::min( env_temperature, temperatures::freezer );
-                    break;
-                case temperature_flag::HEATER:
-                    env_temperature = std::max( env_temperature, temperatures::normal );
-                    break;
-                case temperature_flag::ROOT_CELLAR:
-                    env_temperature = AVERAGE_ANNUAL_TEMPERATURE;
-                    break;
-                default:
-                    debugmsg( "Temperature flag enum not valid.  Using normal temperature." );
-            }
+            const units::temperature env_temperature = history != nullptr ?
+                    history->temperature_at( time ) :
+                    environment_temperature( wgen, pos, time, seed, flag, temp_mod );
 
             // Calculate item temperature from environment temperature
             // If the time was more than 2 d ago we do not care about item temperature.
@@ -20,6 +20,8 @@
 #include "cata_utility.h"
 #include "compatibility.h"
 #include "enums.h"
+#include "flat_map.h"
+#include "flat_set.h"
 #include "gun_mode.h"
 #include "io_tags.h"
 #include "item_components.h"
@@ -184,7 +186,8 @@ inline bool is_crafting_component( const item &component );
 class item : public visitable
 {
     public:
-        using FlagsSetType = std::set<flag_id>;
+        using FlagsSetType = cata::flat_set<flag_id>;
+        using VarsMapType = cata::flat_map<std::string, std::string>;
 
         item();
 
@@ -401,6 +404,22 @@ class item : public visitable
          * charges at all). Calls @ref tname with given quantity and with_prefix being true.
          */
         std::string display_name( unsigned int quantity = 1 ) const;
+        /**
+         * While one is open, @ref tname, @ref display_name and @ref info keep what they return
+         * for each item and return it again when asked with the same arguments, instead of
+         * building it anew. For menus listing many items and redrawing them often.
+         * The cache is dropped when the language changes and when the last scope closes.
+         * Changes to the listed items while a scope is open need @ref invalidate_display_cache.
+         */
+        class display_cache_scope
+        {
+            public:
+                display_cache_scope();
+                ~display_cache_scope();
+                display_cache_scope( const display_cache_scope & ) = delete;
+                display_cache_scope &operator=( const display_cache_scope & ) = delete;
+        };
+        static void invalidate_display_cache();
         /**
          * Return all the information about the item and its type.
          *
@@ -991,7 +1010,7 @@ class item : public visitable
         /**
          * Returns rate of rot (rot/h) at the given temperature
          */
-        float calc_hourly_rotpoints_at_temp( const units::temperature &temp ) const;
+        static float calc_hourly_rotpoints_at_temp( const units::temperature &temp );
 
         /**
          * Accumulate rot of the item since last rot calculation.
@@ -1002,6 +1021,11 @@ class item : public visitable
          */
         void calc_rot( units::temperature temp, float spoil_modifier, const time_duration &time_delta );
 
+        /**
+         * Multiplier calc_rot applies to the hourly rot points, 0 if the item can't rot right now.
+         */
+        float rot_multiplier( float spoil_modifier ) const;
+
         /**
          * This is part of a workaround so that items don't rot away to nothing if the smoking rack
          * is outside the reality bubble.
@@ -2845,6 +2869,14 @@ class item : public visitable
         bool is_collapsed() const;
 
     private:
+        /** What @ref tname, @ref display_name and @ref info return, without the cache. */
+        std::string build_tname( unsigned int quantity, bool with_prefix, unsigned int truncate,
+                                 bool with_contents_full, bool with_collapsed,
+                                 bool with_contents_abbrev ) const;
+        std::string build_display_name( unsigned int quantity ) const;
+        std::string build_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
+                                int batch ) const;
+
         /** migrates an item into this item. */
         void migrate_content_item( const item &contained );
 
@@ -2933,7 +2965,7 @@ class item : public visitable
         FlagsSetType item_tags; // generic item specific flags
         FlagsSetType inherited_tags_cache;
         safe_reference_anchor anchor;
-        std::map<std::string, std::string> item_vars;
+        VarsMapType item_vars;
         const mtype *corpse = nullptr;
         std::string corpse_name;       // Name of the late lamented
         std::set<matec_id> techniques; // item specific techniques
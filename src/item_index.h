@@ -0,0 +1,52 @@
+#pragma once
+#ifndef CATA_SRC_ITEM_INDEX_H
+#define CATA_SRC_ITEM_INDEX_H
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "type_id.h"
+
+class Character;
+class item;
+
+/**
+ * The items a character carries, gathered in one pass and grouped by type, to answer the
+ * inventory queries of @ref visitable without walking all the nested contents for each one.
+ * Results are the same as those of the walks. It is a snapshot: it must be thrown away as soon
+ * as any of the items change, see @ref Character::item_index_scope.
+ * Implemented in visitable.cpp, next to the walks it stands in for.
+ */
+class item_index
+{
+    public:
+        explicit item_index( const Character &who );
+
+        int amount_of( const itype_id &what, bool pseudo, int limit,
+                       const std::function<bool( const item & )> &filter ) const;
+        /**
+         * Charges of the items charges_of() counts, and which kinds of tools it found among
+         * them. Does not handle UPS.
+         */
+        int charges_of( const itype_id &what, int limit,
+                        const std::function<bool( const item & )> &filter, bool in_tools,
+                        bool &found_tool_with_UPS, bool &found_bionic_tool ) const;
+        /** Number of items with at least the given level of the quality, up to limit. */
+        int has_quality( const quality_id &qual, int level, int limit ) const;
+        int max_quality( const quality_id &qual ) const;
+
+    private:
+        /** Every item, outermost first. */
+        std::vector<const item *> items;
+        std::unordered_map<itype_id, std::vector<const item *>> by_type;
+        /**
+         * Items charges_of() looks at, which are not inside anything but containers, by their
+         * type and by the ammo they hold.
+         */
+        std::unordered_map<itype_id, std::vector<const item *>> charges_by_type;
+        std::unordered_map<itype_id, std::vector<const item *>> charges_by_ammo;
+        mutable std::unordered_map<quality_id, int> max_qualities;
+};
+
+#endif // CATA_SRC_ITEM_INDEX_H
@@ -1,6 +1,7 @@
 #include "item_search.h"
 
 #include <map>
+#include <unordered_map>
 #include <utility>
 
 #include "avatar.h"
@@ -27,29 +28,49 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
     switch( flag ) {
         // category
         case 'c':
-            return [filter]( const item & i ) {
-                return lcmatch( i.get_category_of_contents().name(), filter );
+            // Names are matched once per distinct category (material, item type) instead of
+            // once per item, lists usually hold many items of only a few of those.
+            return [filter, matches = std::unordered_map<item_category_id, bool>()](
+            const item & i ) mutable {
+                const item_category &cat = i.get_category_of_contents();
+                auto it = matches.find( cat.get_id() );
+                if( it == matches.end() ) {
+                    it = matches.emplace( cat.get_id(), lcmatch( cat.name(), filter ) ).first;
+                }
+                return it->second;
             };
         // material
         case 'm':
-            return [filter]( const item & i ) {
+            return [filter, matches = std::unordered_map<material_id, bool>()](
+            const item & i ) mutable {
                 return std::any_of( i.made_of().begin(), i.made_of().end(),
-                [&filter]( const std::pair<material_id, int> &mat ) {
-                    return lcmatch( mat.first->name(), filter );
+                [&]( const std::pair<material_id, int> &mat ) {
+                    auto it = matches.find( mat.first );
+                    if( it == matches.end() ) {
+                        const bool match = lcmatch( mat.first->name(), filter );
+                        it = matches.emplace( mat.first, match ).first;
+                    }
+                    return it->second;
                 } );
             };
         // qualities
         case 'q':
-            return [filter]( const item & i ) {
-                return i.type->has_any_quality( filter );
+            return [filter, matches = std::unordered_map<const itype *, bool>()](
+            const item & i ) mutable {
+                auto it = matches.find( i.type );
+                if( it == matches.end() ) {
+                    it = matches.emplace( i.type, i.type->has_any_quality( filter ) ).first;
+                }
+                return it->second;
             };
         // both
-        case 'b':
-            return [filter]( const item & i ) {
-                auto pair = get_both( filter );
-                return item_filter_from_string( pair.first )( i )
-                       && item_filter_from_string( pair.second )( i );
+        case 'b': {
+            const auto pair = get_both( filter );
+            return [first = item_filter_from_string( pair.first ),
+                          second = item_filter_from_string( pair.second )]( const item & i ) {
+                return first( i ) && second( i );
             };
+        }
         // disassembled components
         case 'd':
             return [filter]( const item & i ) {
@@ -44,6 +44,7 @@
 #include "game_constants.h"
 #include "game_inventory.h"
 #include "generic_factory.h"
+#include "interned_flag.h"
 #include "inventory.h"
 #include "item.h"
 #include "item_group.h"
@@ -125,6 +126,8 @@ static const fault_id fault_bionic_salvaged( "fault_bionic_salvaged" );
 
 static const gun_mode_id gun_mode_DEFAULT( "DEFAULT" );
 
+static const interned_flag flag_FIRE_CONTAINER( "FIRE_CONTAINER" );
+
 static const itype_id itype_barrel_small( "barrel_small" );
 static const itype_id itype_brazier( "brazier" );
 static const itype_id itype_char_smoker( "char_smoker" );
@@ -1215,7 +1218,7 @@ bool firestarter_actor::prep_firestarter_use( const Character &p, tripoint_bub_m
     for( const tripoint_bub_ms &query : here.points_in_radius( pos, 1 ) ) {
         // Don't ask if we're setting a fire on top of a fireplace
         // TODO: fix point types
-        if( here.has_flag_furn( "FIRE_CONTAINER", pos.raw() ) ) {
+        if( here.has_flag_furn( flag_FIRE_CONTAINER, pos.raw() ) ) {
             break;
         }
         // Skip the position we're trying to light on fire
@@ -1223,7 +1226,7 @@ bool firestarter_actor::prep_firestarter_use( const Character &p, tripoint_bub_m
             continue;
         }
         // TODO: fix point types
-        if( here.has_flag_furn( "FIRE_CONTAINER", query.raw() ) ) {
+        if( here.has_flag_furn( flag_FIRE_CONTAINER, query.raw() ) ) {
             if( !query_yn( _( "Are you sure you want to start fire here?  There's a fireplace adjacent." ) ) ) {
                 return false;
             } else {
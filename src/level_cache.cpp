@@ -19,6 +19,9 @@ level_cache::level_cache()
     std::fill_n( &seen_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &camera_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &visibility_cache[0][0], map_dimensions, lit_level::DARK );
+    std::fill_n( &heat_radiation_cache[0][0], map_dimensions, 0.0f );
+    std::fill_n( &heat_source_cache[0][0], map_dimensions, 0 );
+    heat_radiation_occlusion_dirty.set();
     clear_vehicle_cache();
 }
 
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "calendar.h"
 #include "game_constants.h"
 #include "lightmap.h"
 #include "point.h"
@@ -87,6 +88,17 @@ struct level_cache {
         std::bitset<MAPSIZE_X *MAPSIZE_Y> map_memory_seen_cache;
         std::bitset<MAPSIZE *MAPSIZE> field_cache;
 
+        // heat radiated onto each tile by fires and hot terrain nearby, see map::heat_radiation_at
+        // units: degrees Fahrenheit
+        cata::mdarray<float, point_bub_ms> heat_radiation_cache;
+        // intensity of the heat source on each tile when heat_radiation_cache was last built
+        cata::mdarray<int, point_bub_ms> heat_source_cache;
+        // submaps whose transparency changed since heat_radiation_cache was last built
+        std::bitset<MAPSIZE *MAPSIZE> heat_radiation_occlusion_dirty;
+        // heat_radiation_cache is rebuilt at most once per turn, and fully if the map shifted
+        time_point heat_radiation_cache_turn = calendar::before_time_starts;
+        tripoint heat_radiation_cache_abs_sub = tripoint_min;
+
         std::set<vehicle *> vehicle_list;
         std::set<vehicle *> zone_vehicles;
 
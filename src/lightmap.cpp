@@ -95,6 +95,7 @@ bool map::build_transparency_cache( const int zlev )
     if( map_cache.transparency_cache_dirty.none() ) {
         return false;
     }
+    map_cache.heat_radiation_occlusion_dirty |= map_cache.transparency_cache_dirty;
 
     // if true, all submaps are invalid (can use batch init)
     bool rebuild_all = map_cache.transparency_cache_dirty.all();
@@ -109,6 +110,8 @@ bool map::build_transparency_cache( const int zlev )
     }
 
     const float sight_penalty = get_weather().weather_id->sight_penalty;
+    const map_data_property_table &ter_props = ter_properties();
+    const map_data_property_table &furn_props = furn_properties();
 
     // Traverse the submaps in order
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
@@ -132,8 +135,8 @@ bool map::build_transparency_cache( const int zlev )
                 const point sp = p - sm_offset;
                 float value = LIGHT_TRANSPARENCY_OPEN_AIR;
 
-                if( !( cur_submap->get_ter( sp ).obj().transparent &&
-                       cur_submap->get_furn( sp ).obj().transparent ) ) {
+                if( !( ter_props.transparent[cur_submap->get_ter( sp ).to_i()] &&
+                       furn_props.transparent[cur_submap->get_furn( sp ).to_i()] ) ) {
                     return std::make_pair( LIGHT_TRANSPARENCY_SOLID, LIGHT_TRANSPARENCY_SOLID );
                 }
                 if( outside_cache[p.x][p.y] ) {
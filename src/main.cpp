@@ -51,6 +51,7 @@
 #include "ordered_static_globals.h"
 #include "path_info.h"
 #include "rng.h"
+#include "save_writer.h"
 #include "system_locale.h"
 #include "translations.h"
 #include "type_id.h"
@@ -136,6 +137,7 @@ void exit_handler( int s )
     const int old_timeout = inp_mngr.get_timeout();
     inp_mngr.reset_timeout();
     if( s != 2 || query_yn( _( "Really Quit?  All unsaved changes will be lost." ) ) ) {
+        save_writer::wait();
         deinitDebug();
 
         int exit_status = 0;
@@ -778,6 +780,7 @@ int main( int argc, const char *argv[] )
         shared_ptr_fast<ui_adaptor> ui = g->create_or_get_main_ui_adaptor();
         get_event_bus().send<event_type::game_begin>( getVersionString() );
         while( !do_turn() );
+        save_writer::wait();
     }
 
     exit_handler( -999 );
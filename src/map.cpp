@@ -51,6 +51,7 @@
 #include "game.h"
 #include "harvest.h"
 #include "iexamine.h"
+#include "interned_flag.h"
 #include "item.h"
 #include "item_category.h"
 #include "item_factory.h"
@@ -91,6 +92,7 @@
 #include "sounds.h"
 #include "string_formatter.h"
 #include "submap.h"
+#include "temperature_history.h"
 #include "tileray.h"
 #include "timed_event.h"
 #include "translations.h"
@@ -123,6 +125,8 @@ static const flag_id json_flag_AVATAR_ONLY( "AVATAR_ONLY" );
 static const flag_id json_flag_PRESERVE_SPAWN_OMT( "PRESERVE_SPAWN_OMT" );
 static const flag_id json_flag_UNDODGEABLE( "UNDODGEABLE" );
 
+static const interned_flag flag_BRIDGE( "BRIDGE" );
+
 static const item_group_id Item_spawn_data_default_zombie_clothes( "default_zombie_clothes" );
 static const item_group_id Item_spawn_data_default_zombie_items( "default_zombie_items" );
 
@@ -2231,7 +2235,7 @@ int map::move_cost_internal( const furn_t &furniture, const ter_t &terrain, cons
     int movecost = std::max( terrain.movecost + field.total_move_cost(), 0 );
 
     if( furniture.id ) {
-        if( furniture.has_flag( "BRIDGE" ) ) {
+        if( furniture.has_flag( flag_BRIDGE ) ) {
             movecost = 2 + std::max( furniture.movecost, 0 );
         } else {
             movecost += std::max( furniture.movecost, 0 );
@@ -2816,7 +2820,7 @@ bool map::can_put_items( const tripoint &p ) const
         return true;
     }
     const optional_vpart_position vp = veh_at( p );
-    return static_cast<bool>( vp.part_with_feature( "CARGO", true ) );
+    return static_cast<bool>( vp.part_with_feature( VPFLAG_CARGO, true ) );
 }
 
 bool map::can_put_items( const tripoint_bub_ms &p ) const
@@ -2861,6 +2865,11 @@ bool map::has_flag_ter_or_furn( const std::string &flag, const tripoint &p ) con
            current_submap->get_furn( l ).obj().has_flag( flag );
 }
 
+bool map::has_flag_furn( const interned_flag &flag, const tripoint &p ) const
+{
+    return furn( p ).obj().has_flag( flag );
+}
+
 bool map::has_flag( const ter_furn_flag flag, const tripoint &p ) const
 {
     return has_flag_ter_or_furn( flag, p ); // Does bound checking
@@ -4682,6 +4691,157 @@ void map::set_temperature_mod( const tripoint &p, units::temperature_delta new_t
 
     current_submap->set_temperature_mod( new_temperature_mod );
 }
+
+// Heat sources affect tiles within this many tiles (square distance)
+static constexpr int HEAT_RADIATION_RANGE = 6;
+
+units::temperature_delta map::heat_radiation_at( const tripoint &p )
+{
+    if( !inbounds( p ) ) {
+        return units::from_kelvin_delta( 0 );
+    }
+    build_heat_radiation_cache( p.z );
+    return units::from_fahrenheit_delta( get_cache_ref( p.z ).heat_radiation_cache[p.x][p.y] );
+}
+
+void map::invalidate_heat_radiation_cache()
+{
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        if( level_cache *ch = get_cache_lazy( z ) ) {
+            ch->heat_radiation_cache_turn = calendar::before_time_starts;
+        }
+    }
+}
+
+// Whether heat radiated from src reaches to.  It traces the line sees() does, but reads the
+// transparency cache directly so the tiles near fires do not crowd out real observers in the
+// vision cache.
+static bool heat_reaches( const level_cache &ch, const point &to, const point &src )
+{
+    bool reaches = true;
+    bresenham( to, src, 0, [&]( const point & p ) {
+        // The source itself does not block its heat
+        if( p == src ) {
+            return false;
+        }
+        if( ch.transparency_cache[p.x][p.y] <= LIGHT_TRANSPARENCY_SOLID ) {
+            reaches = false;
+            return false;
+        }
+        return true;
+    } );
+    return reaches;
+}
+
+void map::build_heat_radiation_cache( const int zlev )
+{
+    level_cache &ch = get_cache( zlev );
+    if( ch.heat_radiation_cache_turn == calendar::turn ) {
+        return;
+    }
+    ch.heat_radiation_cache_turn = calendar::turn;
+
+    auto &heat_cache = ch.heat_radiation_cache;
+    auto &source_cache = ch.heat_source_cache;
+    const bool rebuild_all = ch.heat_radiation_cache_abs_sub != abs_sub.raw() ||
+                             ch.heat_radiation_occlusion_dirty.all();
+    if( rebuild_all ) {
+        std::fill_n( &heat_cache[0][0], MAPSIZE_X * MAPSIZE_Y, 0.0f );
+        ch.heat_radiation_cache_abs_sub = abs_sub.raw();
+    }
+
+    // Tiles within range of a heat source that appeared, disappeared, changed intensity
+    // or might now see it differently.
+    std::bitset<MAPSIZE_X *MAPSIZE_Y> stale;
+    const auto mark_stale_around = [&stale]( const point & src ) {
+        for( int x = std::max( 0, src.x - HEAT_RADIATION_RANGE );
+             x <= std::min( MAPSIZE_X - 1, src.x + HEAT_RADIATION_RANGE ); x++ ) {
+            for( int y = std::max( 0, src.y - HEAT_RADIATION_RANGE );
+                 y <= std::min( MAPSIZE_Y - 1, src.y + HEAT_RADIATION_RANGE ); y++ ) {
+                stale.set( x * MAPSIZE_Y + y );
+            }
+        }
+    };
+    const auto occlusion_changed_around = [&]( const point & src ) {
+        const point sm_min( std::max( 0, src.x - HEAT_RADIATION_RANGE ) / SEEX,
+                            std::max( 0, src.y - HEAT_RADIATION_RANGE ) / SEEY );
+        const point sm_max( std::min( MAPSIZE_X - 1, src.x + HEAT_RADIATION_RANGE ) / SEEX,
+                            std::min( MAPSIZE_Y - 1, src.y + HEAT_RADIATION_RANGE ) / SEEY );
+        for( int smx = sm_min.x; smx <= sm_max.x; smx++ ) {
+            for( int smy = sm_min.y; smy <= sm_max.y; smy++ ) {
+                if( ch.heat_radiation_occlusion_dirty[smx * MAPSIZE + smy] ) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    // Convert it to an int id once, instead of for every tile
+    const field_type_id fd_fire_int = fd_fire.id();
+    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+        for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            const submap *cur_submap = get_submap_at_grid( { smx, smy, zlev } );
+            if( cur_submap == nullptr ) {
+                continue;
+            }
+            for( int sx = 0; sx < SEEX; ++sx ) {
+                for( int sy = 0; sy < SEEY; ++sy ) {
+                    const point sp( sx, sy );
+                    int intensity = 0;
+                    if( cur_submap->field_count > 0 ) {
+                        const field_entry *fire =
+                            cur_submap->get_field( sp ).find_field( fd_fire_int );
+                        intensity = fire == nullptr ? 0 : fire->get_field_intensity();
+                    }
+                    if( intensity <= 0 ) {
+                        intensity = cur_submap->get_ter( sp ).obj().heat_radiation;
+                    }
+                    const point p( sx + smx * SEEX, sy + smy * SEEY );
+                    int &cached = source_cache[p.x][p.y];
+                    const bool changed = cached != intensity;
+                    if( changed || ( intensity != 0 &&
+                                     ( rebuild_all || occlusion_changed_around( p ) ) ) ) {
+                        mark_stale_around( p );
+                    }
+                    cached = intensity;
+                }
+            }
+        }
+    }
+    ch.heat_radiation_occlusion_dirty.reset();
+
+    if( stale.none() ) {
+        return;
+    }
+    for( int x = 0; x < MAPSIZE_X; x++ ) {
+        for( int y = 0; y < MAPSIZE_Y; y++ ) {
+            if( !stale[x * MAPSIZE_Y + y] ) {
+                continue;
+            }
+            const point location( x, y );
+            float heat = 0.0f;
+            for( int sx = std::max( 0, x - HEAT_RADIATION_RANGE );
+                 sx <= std::min( MAPSIZE_X - 1, x + HEAT_RADIATION_RANGE ); sx++ ) {
+                for( int sy = std::max( 0, y - HEAT_RADIATION_RANGE );
+                     sy <= std::min( MAPSIZE_Y - 1, y + HEAT_RADIATION_RANGE ); sy++ ) {
+                    const int heat_intensity = source_cache[sx][sy];
+                    if( heat_intensity == 0 ) {
+                        continue;
+                    }
+                    const point src( sx, sy );
+                    if( !heat_reaches( ch, location, src ) ) {
+                        continue;
+                    }
+                    // Ensure fire_dist >= 1 to avoid divide-by-zero errors.
+                    const int fire_dist = std::max( 1, square_dist( src, location ) );
+                    heat += 6.f * heat_intensity * heat_intensity / fire_dist;
+                }
+            }
+            heat_cache[x][y] = heat;
+        }
+    }
+}
 // Items: 3D
 
 map_stack map::i_at( const tripoint &p )
@@ -5600,7 +5760,8 @@ std::list<item> map::use_amount_square( const tripoint &p, const itype_id &type,
         return ret;
     }
 
-    if( const std::optional<vpart_reference> vp = veh_at( p ).part_with_feature( "CARGO", true ) ) {
+    if( const std::optional<vpart_reference> vp =
+            veh_at( p ).part_with_feature( VPFLAG_CARGO, true ) ) {
         std::list<item> tmp = use_amount_stack( vp->vehicle().get_items( vp->part_index() ), type,
                                                 quantity, filter );
         ret.splice( ret.end(), tmp );
@@ -5614,7 +5775,8 @@ std::list<item_location> map::items_with( const tripoint &p,
         const std::function<bool( const item & )> &filter )
 {
     std::list<item_location> ret;
-    if( const std::optional<vpart_reference> vp = veh_at( p ).part_with_feature( "CARGO", true ) ) {
+    if( const std::optional<vpart_reference> vp =
+            veh_at( p ).part_with_feature( VPFLAG_CARGO, true ) ) {
         for( item &it : vp->vehicle().get_items( vp->part_index() ) ) {
             if( filter( it ) ) {
                 ret.emplace_back( vehicle_cursor( vp->vehicle(), vp->part_index() ), &it );
@@ -6979,18 +7141,20 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         bresenham_slope = 0;
         return false; // Out of range!
     }
-    // Canonicalize the order of the tripoints so the cache is reflexive.
-    const tripoint &min = F < T ? F : T;
-    const tripoint &max = !( F < T ) ? F : T;
-    // A little gross, just pack the values into a point.
-    const point key(
-        min.x << 16 | min.y << 8 | ( min.z + OVERMAP_DEPTH ),
-        max.x << 16 | max.y << 8 | ( max.z + OVERMAP_DEPTH )
-    );
-    char cached = skew_vision_cache.get( key, -1 );
-    if( cached >= 0 ) {
-        return cached > 0;
+    // The line is traced in one direction only, and the line back may pass other tiles.
+    // The cache stores the pair under the same key for both, so visibility stays reflexive.
+    const bool cacheable = inbounds( F );
+    if( cacheable ) {
+        const int cached = skew_vision_cache.get( F, T );
+        if( cached >= 0 ) {
+            return cached > 0;
+        }
     }
+    const auto remember = [&]( const bool visible ) {
+        if( cacheable ) {
+            skew_vision_cache.insert( F, T, visible );
+        }
+    };
     bool visible = true;
 
     // Ugly `if` for now
@@ -7007,7 +7171,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
             }
             return true;
         } );
-        skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        remember( visible );
         return visible;
     }
 
@@ -7040,7 +7204,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         last_point = new_point;
         return true;
     } );
-    skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+    remember( visible );
     return visible;
 }
 
@@ -7712,6 +7876,25 @@ bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type
     return ret;
 }
 
+bool generate_omt( const tripoint_abs_omt &p )
+{
+    // Each overmap square is two nonants; to prevent overlap, generate only at
+    //  squares divisible by 2.
+    const tripoint_abs_sm p_sm = project_to<coords::sm>( p );
+
+    const oter_id terrain_type = overmap_buffer.ter( p );
+
+    // Short-circuit if the map tile is uniform
+    // TODO: Replace with json mapgen functions.
+    if( generate_uniform_omt( p_sm, terrain_type ) ) {
+        return false;
+    }
+    tinymap tmp_map;
+    tmp_map.main_cleanup_override( false );
+    tmp_map.generate( p_sm, calendar::turn );
+    return tmp_map.is_main_cleanup_queued();
+}
+
 void map::loadn( const tripoint &grid, const bool update_vehicles )
 {
     dbg( D_INFO ) << "map::loadn(game[" << g.get() << "], worldx[" << abs_sub.x()
@@ -7733,21 +7916,8 @@ void map::loadn( const tripoint &grid, const bool update_vehicles )
         // It doesn't exist; we must generate it!
         dbg( D_INFO | D_WARNING ) << "map::loadn: Missing mapbuffer data.  Regenerating.";
 
-        // Each overmap square is two nonants; to prevent overlap, generate only at
-        //  squares divisible by 2.
-        const tripoint_abs_omt grid_abs_omt = project_to<coords::omt>( grid_abs_sub );
-        const tripoint_abs_sm grid_abs_sub_rounded = project_to<coords::sm>( grid_abs_omt );
-
-        const oter_id terrain_type = overmap_buffer.ter( grid_abs_omt );
-
-        // Short-circuit if the map tile is uniform
-        // TODO: Replace with json mapgen functions.
-        if( !generate_uniform_omt( grid_abs_sub_rounded, terrain_type ) ) {
-            tinymap tmp_map;
-            tmp_map.main_cleanup_override( false );
-            tmp_map.generate( grid_abs_sub_rounded, calendar::turn );
-            _main_requires_cleanup |= main_inbounds && tmp_map.is_main_cleanup_queued();
-        }
+        const bool cleanup_queued = generate_omt( project_to<coords::omt>( grid_abs_sub ) );
+        _main_requires_cleanup |= main_inbounds && cleanup_queued;
 
         // This is the same call to MAPBUFFER as above!
         tmpsub = MAPBUFFER.lookup_submap( grid_abs_sub );
@@ -8158,8 +8328,12 @@ void map::actualize( const tripoint &grid )
     const bool do_funnels = grid.z >= 0;
 
     // check spoiled stuff, and fill up funnels while we're at it
-    process_items_in_vehicles( *tmpsub );
-    process_items_in_submap( *tmpsub, grid );
+    {
+        // Items left here share the temperature history while they catch up on the time away
+        scoped_temperature_history_cache history_cache;
+        process_items_in_vehicles( *tmpsub );
+        process_items_in_submap( *tmpsub, grid );
+    }
     explosion_handler::process_explosions();
     for( int x = 0; x < SEEX; x++ ) {
         for( int y = 0; y < SEEY; y++ ) {
@@ -8886,6 +9060,13 @@ bool map::build_floor_cache( const int zlev )
 
     bool lowest_z_lev = zlev <= -OVERMAP_DEPTH;
 
+    const map_data_property_table &ter_props = ter_properties();
+    const map_data_property_table &furn_props = furn_properties();
+    enum_bitset<ter_furn_flag> no_floor;
+    no_floor.set( ter_furn_flag::TFLAG_NO_FLOOR );
+    no_floor.set( ter_furn_flag::TFLAG_GOES_DOWN );
+    no_floor.set( ter_furn_flag::TFLAG_TRANSPARENT_FLOOR );
+
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
             const submap *cur_submap = get_submap_at_grid( { smx, smy, zlev } );
@@ -8901,22 +9082,21 @@ bool map::build_floor_cache( const int zlev )
                 continue;
             }
 
-            for( int sx = 0; sx < SEEX; ++sx ) {
-                for( int sy = 0; sy < SEEY; ++sy ) {
-                    point sp( sx, sy );
-                    const ter_t &terrain = cur_submap->get_ter( sp ).obj();
-                    if( terrain.has_flag( ter_furn_flag::TFLAG_NO_FLOOR ) ||
-                        terrain.has_flag( ter_furn_flag::TFLAG_GOES_DOWN ) ||
-                        terrain.has_flag( ter_furn_flag::TFLAG_TRANSPARENT_FLOOR ) ) {
-                        if( below_submap &&
-                            below_submap->get_furn( sp ).obj().has_flag( ter_furn_flag::TFLAG_SUN_ROOF_ABOVE ) ) {
-                            continue;
-                        }
-                        const point p( sx + smx * SEEX, sy + smy * SEEY );
-                        floor_cache[p.x][p.y] = false;
-                        no_floor_gaps = false;
-                    }
+            const ter_id *ter = cur_submap->get_ter_array();
+            const ter_id uniform_ter = cur_submap->get_ter( point_zero );
+            // Uniform submaps have no furniture, so none with a sun roof
+            const furn_id *furn_below = below_submap ? below_submap->get_furn_array() : nullptr;
+            for( int i = 0; i < SEEX * SEEY; ++i ) {
+                const ter_id t = ter ? ter[i] : uniform_ter;
+                if( !ter_props.flags[t.to_i()].test_any( no_floor ) ) {
+                    continue;
                 }
+                if( furn_below &&
+                    furn_props.flags[furn_below[i].to_i()][ter_furn_flag::TFLAG_SUN_ROOF_ABOVE] ) {
+                    continue;
+                }
+                floor_cache[smx * SEEX + i / SEEY][smy * SEEY + i % SEEY] = false;
+                no_floor_gaps = false;
             }
         }
     }
@@ -9447,14 +9627,16 @@ void map::scent_blockers( std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &bl
 {
     ter_furn_flag reduce = ter_furn_flag::TFLAG_REDUCE_SCENT;
     ter_furn_flag block = ter_furn_flag::TFLAG_NO_SCENT;
+    const map_data_property_table &ter_props = ter_properties();
+    const map_data_property_table &furn_props = furn_properties();
     auto fill_values = [&]( const tripoint & gp, const submap * sm, const point & lp ) {
         // We need to generate the x/y coordinates, because we can't get them "for free"
         const point p = lp + sm_to_ms_copy( gp.xy() );
-        if( sm->get_ter( lp ).obj().has_flag( block ) ) {
+        const enum_bitset<ter_furn_flag> &ter_flags = ter_props.flags[sm->get_ter( lp ).to_i()];
+        if( ter_flags[block] ) {
             blocks_scent[p.x][p.y] = true;
             reduces_scent[p.x][p.y] = false;
-        } else if( sm->get_ter( lp ).obj().has_flag( reduce ) ||
-                   sm->get_furn( lp ).obj().has_flag( reduce ) ) {
+        } else if( ter_flags[reduce] || furn_props.flags[sm->get_furn( lp ).to_i()][reduce] ) {
             blocks_scent[p.x][p.y] = false;
             reduces_scent[p.x][p.y] = true;
         } else {
@@ -9716,6 +9898,14 @@ void map::update_pathfinding_cache( int zlev ) const
 
     std::uninitialized_fill_n( &cache.special[0][0], MAPSIZE_X * MAPSIZE_Y, PF_NORMAL );
 
+    const map_data_property_table &ter_props = ter_properties();
+    enum_bitset<ter_furn_flag> updown;
+    updown.set( ter_furn_flag::TFLAG_GOES_DOWN );
+    updown.set( ter_furn_flag::TFLAG_GOES_UP );
+    updown.set( ter_furn_flag::TFLAG_RAMP );
+    updown.set( ter_furn_flag::TFLAG_RAMP_UP );
+    updown.set( ter_furn_flag::TFLAG_RAMP_DOWN );
+
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
             const submap *cur_submap = get_submap_at_grid( { smx, smy, zlev } );
@@ -9736,6 +9926,8 @@ void map::update_pathfinding_cache( int zlev ) const
 
                     const ter_t &terrain = tile.get_ter_t();
                     const furn_t &furniture = tile.get_furn_t();
+                    const enum_bitset<ter_furn_flag> &ter_flags =
+                        ter_props.flags[tile.get_ter().to_i()];
                     const field &field = tile.get_field();
                     int part;
                     const vehicle *veh = veh_at_internal( p, part );
@@ -9746,7 +9938,7 @@ void map::update_pathfinding_cache( int zlev ) const
                         cur_value |= PF_SLOW;
                     } else if( cost <= 0 ) {
                         cur_value |= PF_WALL;
-                        if( terrain.has_flag( ter_furn_flag::TFLAG_CLIMBABLE ) ) {
+                        if( ter_flags[ter_furn_flag::TFLAG_CLIMBABLE] ) {
                             cur_value |= PF_CLIMBABLE;
                         }
                     }
@@ -9766,14 +9958,11 @@ void map::update_pathfinding_cache( int zlev ) const
                         cur_value |= PF_TRAP;
                     }
 
-                    if( terrain.has_flag( ter_furn_flag::TFLAG_GOES_DOWN ) ||
-                        terrain.has_flag( ter_furn_flag::TFLAG_GOES_UP ) ||
-                        terrain.has_flag( ter_furn_flag::TFLAG_RAMP ) || terrain.has_flag( ter_furn_flag::TFLAG_RAMP_UP ) ||
-                        terrain.has_flag( ter_furn_flag::TFLAG_RAMP_DOWN ) ) {
+                    if( ter_flags.test_any( updown ) ) {
                         cur_value |= PF_UPDOWN;
                     }
 
-                    if( terrain.has_flag( ter_furn_flag::TFLAG_SHARP ) ) {
+                    if( ter_flags[ter_furn_flag::TFLAG_SHARP] ) {
                         cur_value |= PF_SHARP;
                     }
 
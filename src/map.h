@@ -33,7 +33,6 @@
 #include "level_cache.h"
 #include "lightmap.h"
 #include "line.h"
-#include "lru_cache.h"
 #include "map_selector.h"
 #include "mapdata.h"
 #include "maptile_fwd.h"
@@ -43,6 +42,7 @@
 #include "type_id.h"
 #include "units.h"
 #include "value_ptr.h"
+#include "vision_pair_cache.h"
 
 struct scent_block;
 
@@ -57,6 +57,7 @@ class character_id;
 class computer;
 class field;
 class field_entry;
+class interned_flag;
 class item_location;
 class mapgendata;
 class monster;
@@ -954,6 +955,9 @@ class map
         bool has_flag_ter_or_furn( const std::string &flag, const point &p ) const {
             return has_flag_ter_or_furn( flag, tripoint( p, abs_sub.z() ) );
         }
+        // Same as the string version above, for furniture flags that have no ter_furn_flag but
+        // are checked often enough to be worth an interned handle
+        bool has_flag_furn( const interned_flag &flag, const tripoint &p ) const;
         // Fast "oh hai it's update_scent/lightmap/draw/monmove/self/etc again, what about this one" flag checking
         // Checks terrain, furniture and vehicles
         // TODO: fix point types (remove the first overload)
@@ -1208,6 +1212,14 @@ class map
 
         // Temperature modifier for submap
         units::temperature_delta get_temperature_mod( const tripoint &p ) const;
+        /**
+         * Heat radiated onto p by fires and hot terrain within 6 tiles that p can see.
+         * Read from a per z-level field, which is brought up to date at most once per turn
+         * and only recalculated around heat sources that changed.
+         */
+        units::temperature_delta heat_radiation_at( const tripoint &p );
+        // Forces the heat radiation field to be checked for changes on the next query.
+        void invalidate_heat_radiation_cache();
         // Set temperature modifier for all four submap quadrants
         void set_temperature_mod( const tripoint &p, units::temperature_delta temperature_mod );
         void set_temperature_mod( const point &p, units::temperature_delta new_temperature_mod ) {
@@ -1921,6 +1933,7 @@ class map
         // Used to determine if seen cache should be rebuilt.
         bool build_transparency_cache( int zlev );
         bool build_vision_transparency_cache( int zlev );
+        void build_heat_radiation_cache( int zlev );
         // fills lm with sunlight. pzlev is current player's zlevel
         void build_sunlight_cache( int pzlev );
     public:
@@ -2187,9 +2200,10 @@ class map
         std::set<tripoint_abs_sm> submaps_with_active_items_dirty;
 
         /**
-         * Cache of coordinate pairs recently checked for visibility.
+         * Coordinate pairs recently checked for visibility, cleared whenever transparency
+         * changes.
          */
-        mutable lru_cache<point, char> skew_vision_cache;
+        mutable vision_pair_cache skew_vision_cache;
 
         // Note: no bounds check
         level_cache &get_cache( int zlev ) const {
@@ -2287,6 +2301,11 @@ void shift_bitset_cache( std::bitset<SIZE *SIZE> &cache, const point &s );
 bool ter_furn_has_flag( const ter_t &ter, const furn_t &furn, ter_furn_flag flag );
 bool generate_uniform( const tripoint_abs_sm &p, const oter_id &oter );
 bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type );
+/**
+ * Generates the submaps of the overmap terrain at p and stores them in the mapbuffer.
+ * Returns whether the mapgen wants the main map to be cleaned up afterwards.
+ */
+bool generate_omt( const tripoint_abs_omt &p );
 class tinymap : public map
 {
         friend class editmap;
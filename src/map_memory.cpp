@@ -1,3 +1,12 @@
+#include <cstdint>
+#include <deque>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "cata_assert.h"
 #include "cached_options.h"
 #include "cata_utility.h"
@@ -23,10 +32,49 @@ static cata_path find_mm_dir()
 }
 
 static cata_path find_region_path( const cata_path &dirname, const tripoint &p )
+{
+    return dirname / string_format( "%d.%d.%d.mmb", p.x, p.y, p.z );
+}
+
+// Regions used to be saved as json, these are still read if there is no binary file.
+static cata_path find_legacy_region_path( const cata_path &dirname, const tripoint &p )
 {
     return dirname / string_format( "%d.%d.%d.mmr", p.x, p.y, p.z );
 }
 
+/**
+ * Every terrain and decoration id ever memorized, so tiles only need to store an index.
+ * Index 0 is the empty id.  Ids are never removed, there are only as many as there are
+ * terrains, furnitures, vehicle parts etc. with their variants.
+ */
+struct memorized_id_table {
+    // deque, so references to the strings stay valid
+    std::deque<std::string> ids;
+    std::unordered_map<std::string, uint32_t> indices;
+
+    memorized_id_table() {
+        intern( std::string_view() );
+    }
+
+    uint32_t intern( const std::string_view id ) {
+        std::string key( id );
+        const auto it = indices.find( key );
+        if( it != indices.end() ) {
+            return it->second;
+        }
+        const uint32_t idx = ids.size();
+        ids.push_back( key );
+        indices.emplace( std::move( key ), idx );
+        return idx;
+    }
+};
+
+static memorized_id_table &memorized_ids()
+{
+    static memorized_id_table table;
+    return table;
+}
+
 /**
  * Helper class for converting global sm coord into
  * global mm_region coord + sm coord within the region.
@@ -85,24 +133,230 @@ bool mm_region::is_empty() const
     return true;
 }
 
+/**
+ * Binary region format, all numbers little endian:
+ *
+ *   "CMMR" u8:version
+ *   u16:number of ids, then for each id: u16:length, bytes
+ *   for each submap of the region, y major: u16:number of runs (0 for an empty submap),
+ *   then for each run of identical tiles:
+ *     u8:length u8:flags u32:symbol u16:terrain id u16:decoration id
+ *     if flags & WIDE: i8 terrain subtile, rotation, decoration subtile, rotation
+ *     else: u8 terrain, u8 decoration, each subtile << 4 | rotation
+ * Ids are indices into the region's own id table, index 0 is the empty id.
+ */
+static constexpr char mm_region_magic[4] = { 'C', 'M', 'M', 'R' };
+static constexpr uint8_t mm_region_version = 1;
+static constexpr uint8_t mm_run_wide = 1;
+
+static_assert( SEEX * SEEY <= UINT8_MAX, "run length must fit in a byte" );
+static_assert( 2 * SEEX * SEEY * MM_REG_SIZE * MM_REG_SIZE < UINT16_MAX,
+               "region id table must fit 16 bit indices" );
+
+template<typename T>
+static void write_le( std::ostream &fout, T value )
+{
+    for( size_t i = 0; i < sizeof( T ); i++ ) {
+        fout.put( static_cast<char>( ( static_cast<uint64_t>( value ) >> ( 8 * i ) ) & 0xff ) );
+    }
+}
+
+template<typename T>
+static T read_le( std::istream &fin )
+{
+    uint64_t value = 0;
+    for( size_t i = 0; i < sizeof( T ); i++ ) {
+        const int c = fin.get();
+        if( c == std::char_traits<char>::eof() ) {
+            throw std::runtime_error( "unexpected end of memory map region" );
+        }
+        value |= static_cast<uint64_t>( c & 0xff ) << ( 8 * i );
+    }
+    return static_cast<T>( value );
+}
+
+static bool fits_nibble( int v )
+{
+    return v >= 0 && v < 16;
+}
+
+void mm_region::serialize_binary( std::ostream &fout ) const
+{
+    // Region-local id table, so indices stay small and files don't depend on the session.
+    std::vector<uint32_t> region_ids{ 0 };
+    std::unordered_map<uint32_t, uint16_t> region_idx{ { 0, 0 } };
+    const auto local_id = [&]( uint32_t id ) {
+        const auto it = region_idx.find( id );
+        if( it != region_idx.end() ) {
+            return it->second;
+        }
+        const uint16_t idx = region_ids.size();
+        region_ids.push_back( id );
+        region_idx.emplace( id, idx );
+        return idx;
+    };
+
+    // Collect the runs first, the id table has to come before them.
+    struct run {
+        uint8_t length;
+        const memorized_tile *tile;
+    };
+    std::vector<std::vector<run>> submap_runs;
+    submap_runs.reserve( MM_REG_SIZE * MM_REG_SIZE );
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        // NOLINTNEXTLINE(modernize-loop-convert)
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            const mm_submap &sm = *submaps[x][y];
+            std::vector<run> &runs = submap_runs.emplace_back();
+            if( sm.is_empty() ) {
+                continue;
+            }
+            for( int i = 0; i < SEEX * SEEY; i++ ) {
+                const memorized_tile &tile = sm.get_tile( point( i % SEEX, i / SEEX ) );
+                if( !runs.empty() && *runs.back().tile == tile ) {
+                    runs.back().length++;
+                } else {
+                    local_id( tile.ter_id );
+                    local_id( tile.dec_id );
+                    runs.push_back( { 1, &tile } );
+                }
+            }
+        }
+    }
+
+    fout.write( mm_region_magic, sizeof( mm_region_magic ) );
+    write_le<uint8_t>( fout, mm_region_version );
+    write_le<uint16_t>( fout, region_ids.size() );
+    const memorized_id_table &ids = memorized_ids();
+    for( const uint32_t id : region_ids ) {
+        const std::string &str = ids.ids[id];
+        write_le<uint16_t>( fout, str.size() );
+        fout.write( str.data(), str.size() );
+    }
+    for( const std::vector<run> &runs : submap_runs ) {
+        write_le<uint16_t>( fout, runs.size() );
+        for( const run &r : runs ) {
+            const memorized_tile &t = *r.tile;
+            const bool wide = !fits_nibble( t.ter_subtile ) || !fits_nibble( t.ter_rotation ) ||
+                              !fits_nibble( t.dec_subtile ) || !fits_nibble( t.dec_rotation );
+            write_le<uint8_t>( fout, r.length );
+            write_le<uint8_t>( fout, wide ? mm_run_wide : 0 );
+            write_le<uint32_t>( fout, t.symbol );
+            write_le<uint16_t>( fout, region_idx[t.ter_id] );
+            write_le<uint16_t>( fout, region_idx[t.dec_id] );
+            if( wide ) {
+                write_le<uint8_t>( fout, t.ter_subtile );
+                write_le<uint8_t>( fout, t.ter_rotation );
+                write_le<uint8_t>( fout, t.dec_subtile );
+                write_le<uint8_t>( fout, t.dec_rotation );
+            } else {
+                write_le<uint8_t>( fout, t.ter_subtile << 4 | t.ter_rotation );
+                write_le<uint8_t>( fout, t.dec_subtile << 4 | t.dec_rotation );
+            }
+        }
+    }
+}
+
+void mm_region::deserialize_binary( std::istream &fin )
+{
+    char magic[sizeof( mm_region_magic )];
+    fin.read( magic, sizeof( magic ) );
+    if( !fin ||
+        !std::equal( std::begin( magic ), std::end( magic ), std::begin( mm_region_magic ) ) ) {
+        throw std::runtime_error( "not a memory map region" );
+    }
+    const uint8_t version = read_le<uint8_t>( fin );
+    if( version != mm_region_version ) {
+        throw std::runtime_error( string_format( "unknown memory map region version %d",
+                                  version ) );
+    }
+
+    memorized_id_table &ids = memorized_ids();
+    std::vector<uint32_t> region_ids( read_le<uint16_t>( fin ) );
+    std::string str;
+    for( uint32_t &id : region_ids ) {
+        str.resize( read_le<uint16_t>( fin ) );
+        fin.read( &str[0], str.size() );
+        if( !fin ) {
+            throw std::runtime_error( "unexpected end of memory map region" );
+        }
+        id = ids.intern( str );
+    }
+    const auto global_id = [&]( uint16_t idx ) {
+        if( idx >= region_ids.size() ) {
+            throw std::runtime_error( "invalid id index in memory map region" );
+        }
+        return region_ids[idx];
+    };
+
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        // NOLINTNEXTLINE(modernize-loop-convert)
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            shared_ptr_fast<mm_submap> &sm = submaps[x][y];
+            sm = make_shared_fast<mm_submap>();
+            const int num_runs = read_le<uint16_t>( fin );
+            int i = 0;
+            for( int r = 0; r < num_runs; r++ ) {
+                const int length = read_le<uint8_t>( fin );
+                const uint8_t flags = read_le<uint8_t>( fin );
+                memorized_tile tile;
+                tile.symbol = read_le<uint32_t>( fin );
+                tile.ter_id = global_id( read_le<uint16_t>( fin ) );
+                tile.dec_id = global_id( read_le<uint16_t>( fin ) );
+                if( flags & mm_run_wide ) {
+                    tile.ter_subtile = read_le<int8_t>( fin );
+                    tile.ter_rotation = read_le<int8_t>( fin );
+                    tile.dec_subtile = read_le<int8_t>( fin );
+                    tile.dec_rotation = read_le<int8_t>( fin );
+                } else {
+                    const uint8_t ter = read_le<uint8_t>( fin );
+                    const uint8_t dec = read_le<uint8_t>( fin );
+                    tile.ter_subtile = ter >> 4;
+                    tile.ter_rotation = ter & 0x0f;
+                    tile.dec_subtile = dec >> 4;
+                    tile.dec_rotation = dec & 0x0f;
+                }
+                if( i + length > SEEX * SEEY ) {
+                    throw std::runtime_error( "too many tiles in memory map submap" );
+                }
+                const bool is_default = tile == mm_submap::default_tile;
+                for( const int end = i + length; i < end; i++ ) {
+                    // Try to avoid assigning to save up on memory
+                    if( !is_default ) {
+                        sm->set_tile( point( i % SEEX, i / SEEX ), tile );
+                    }
+                }
+            }
+            if( num_runs > 0 && i != SEEX * SEEY ) {
+                throw std::runtime_error( "too few tiles in memory map submap" );
+            }
+        }
+    }
+}
+
 const std::string &memorized_tile::get_ter_id() const
 {
-    return ter_id.str();
+    return memorized_ids().ids[ter_id];
 }
 
 const std::string &memorized_tile::get_dec_id() const
 {
-    return dec_id;
+    return memorized_ids().ids[dec_id];
 }
 
 void memorized_tile::set_ter_id( const std::string_view id )
 {
-    ter_id = ter_str_id( id );
+    // Tiles mostly get memorized again with what they already hold
+    if( get_ter_id() != id ) {
+        ter_id = memorized_ids().intern( id );
+    }
 }
 
 void memorized_tile::set_dec_id( const std::string_view id )
 {
-    dec_id = id;
+    if( get_dec_id() != id ) {
+        dec_id = memorized_ids().intern( id );
+    }
 }
 
 int memorized_tile::get_ter_rotation() const
@@ -345,12 +599,20 @@ shared_ptr_fast<mm_submap> map_memory::load_submap( const tripoint &sm_pos )
     const cata_path path = find_region_path( find_mm_dir(), p.reg );
 
     mm_region mmr;
-    const auto loader = [&mmr]( const JsonValue & jsin ) {
+    const auto loader = [&mmr]( std::istream & fin ) {
+        mmr.deserialize_binary( fin );
+    };
+    const auto legacy_loader = [&mmr]( const JsonValue & jsin ) {
         mmr.deserialize( jsin );
     };
 
     try {
-        if( !read_from_file_optional_json( path, loader ) ) {
+        if( file_exist( path ) ) {
+            if( !read_from_file( path, loader ) ) {
+                return nullptr;
+            }
+        } else if( !read_from_file_optional_json( find_legacy_region_path( find_mm_dir(), p.reg ),
+                   legacy_loader ) ) {
             // Region not found
             return nullptr;
         }
@@ -463,14 +725,15 @@ bool map_memory::save( const tripoint &pos )
                                       );
 
             const auto writer = [&]( std::ostream & fout ) -> void {
-                fout << serialize_wrapper( [&]( JsonOut & jsout )
-                {
-                    reg.serialize( jsout );
-                } );
+                reg.serialize_binary( fout );
             };
 
             const bool res = write_to_file( path, writer, descr.c_str() );
             result = result & res;
+            const cata_path legacy_path = find_legacy_region_path( dirname, regp );
+            if( res && file_exist( legacy_path ) ) {
+                remove_file( legacy_path.get_unrelative_path() );
+            }
         }
         tripoint regp_sm = mmr_to_sm_copy( regp );
         half_open_rectangle<point> rect_reg( regp_sm.xy(), regp_sm.xy() + point( MM_REG_SIZE,
@@ -2,7 +2,10 @@
 #ifndef CATA_SRC_MAP_MEMORY_H
 #define CATA_SRC_MAP_MEMORY_H
 
+#include <cstdint>
 #include <iosfwd>
+#include <string>
+#include <string_view>
 
 #include "game_constants.h"
 #include "mdarray.h"
@@ -13,9 +16,6 @@ class JsonObject;
 class JsonOut;
 class JsonValue;
 
-struct ter_t;
-using ter_str_id = string_id<ter_t>;
-
 class memorized_tile
 {
     public:
@@ -42,8 +42,10 @@ class memorized_tile
         }
     private:
         friend struct mm_submap; // serialization needs access to private members
-        ter_str_id ter_id;       // terrain tile id
-        std::string dec_id;      // decoration tile id (furniture, vparts ...)
+        friend struct mm_region;
+        // Ids are interned in a table shared by all tiles, these are indices into it.
+        uint32_t ter_id = 0;     // terrain tile id
+        uint32_t dec_id = 0;     // decoration tile id (furniture, vparts ...)
         int8_t ter_rotation = 0;
         int8_t dec_rotation = 0;
         int8_t ter_subtile = 0;
@@ -90,6 +92,10 @@ struct mm_region {
 
     void serialize( JsonOut &jsout ) const;
     void deserialize( const JsonValue &ja );
+
+    /** Compact binary format used for region files, see map_memory.cpp. */
+    void serialize_binary( std::ostream &fout ) const;
+    void deserialize_binary( std::istream &fin );
 };
 
 /**
@@ -1,5 +1,6 @@
 #include "mapbuffer.h"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <functional>
@@ -7,6 +8,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -21,6 +23,7 @@
 #include "overmapbuffer.h"
 #include "path_info.h"
 #include "popup.h"
+#include "save_writer.h"
 #include "string_formatter.h"
 #include "submap.h"
 #include "translations.h"
@@ -47,6 +50,12 @@ static cata_path find_dirname( const tripoint_abs_omt &om_addr )
             segment_addr.y(), segment_addr.z() );
 }
 
+// Quads unloaded between saves, see mapbuffer::unload_least_recently_used
+static cata_path find_unsaved_quad_path( const tripoint_abs_omt &om_addr )
+{
+    return find_quad_path( PATH_INFO::world_base_save_path_path() / "maps.unsaved", om_addr );
+}
+
 mapbuffer MAPBUFFER;
 
 mapbuffer::mapbuffer() = default;
@@ -55,6 +64,20 @@ mapbuffer::~mapbuffer() = default;
 void mapbuffer::clear()
 {
     submaps.clear();
+    quad_last_used.clear();
+    discard_unsaved_quads();
+}
+
+void mapbuffer::discard_unsaved_quads()
+{
+    if( unsaved_quads.empty() ) {
+        return;
+    }
+    save_writer::flush();
+    for( const tripoint_abs_omt &quad : unsaved_quads ) {
+        remove_file( find_unsaved_quad_path( quad ).get_unrelative_path() );
+    }
+    unsaved_quads.clear();
 }
 
 void mapbuffer::clear_outside_reality_bubble()
@@ -65,11 +88,83 @@ void mapbuffer::clear_outside_reality_bubble()
         if( here.inbounds( it->first ) ) {
             ++it;
         } else {
+            quad_last_used.erase( project_to<coords::omt>( it->first ) );
             it = submaps.erase( it );
         }
     }
 }
 
+void mapbuffer::unload_least_recently_used( size_t max_submaps )
+{
+    if( submaps.size() <= max_submaps ) {
+        return;
+    }
+
+    struct candidate {
+        tripoint_abs_omt quad;
+        uint64_t last_used;
+        int distance;
+    };
+
+    map &here = get_map();
+    const tripoint_abs_omt center = project_to<coords::omt>( here.get_abs_sub() +
+                                    point( HALF_MAPSIZE, HALF_MAPSIZE ) );
+    std::unordered_set<tripoint_abs_omt> seen;
+    std::vector<candidate> candidates;
+    for( const auto &elem : submaps ) {
+        const tripoint_abs_omt quad = project_to<coords::omt>( elem.first );
+        if( here.inbounds( quad ) || !seen.insert( quad ).second ) {
+            continue;
+        }
+        const auto last_used = quad_last_used.find( quad );
+        candidates.push_back( { quad, last_used == quad_last_used.end() ? 0 : last_used->second,
+                                rl_dist( quad, center ) } );
+    }
+    std::sort( candidates.begin(), candidates.end(),
+    []( const candidate & l, const candidate & r ) {
+        if( l.last_used != r.last_used ) {
+            return l.last_used < r.last_used;
+        }
+        return l.distance > r.distance;
+    } );
+
+    // Go somewhat below the limit, so this doesn't have to run again right away.
+    const size_t target = max_submaps - max_submaps / 8;
+    const cata_path unsaved_dirname = PATH_INFO::world_base_save_path_path() / "maps.unsaved";
+    std::list<tripoint_abs_sm> submaps_to_delete;
+    for( const candidate &c : candidates ) {
+        if( submaps.size() - submaps_to_delete.size() <= target ) {
+            break;
+        }
+        // Not to the map files: they must stay as of the last save in case the game is not
+        // saved again
+        const cata_path quad_path = find_unsaved_quad_path( c.quad );
+        if( save_quad( unsaved_dirname, quad_path, c.quad, submaps_to_delete, true ) ) {
+            unsaved_quads.insert( c.quad );
+        } else {
+            // It went uniform since it was written there, so that copy is not read any more
+            unsaved_quads.erase( c.quad );
+        }
+    }
+    for( const tripoint_abs_sm &elem : submaps_to_delete ) {
+        remove_submap( elem );
+    }
+    num_unloaded_submaps += submaps_to_delete.size();
+
+    dbg( D_INFO ) << "unloaded " << submaps_to_delete.size() << " submaps, " << submaps.size()
+                  << " submaps (~" << resident_bytes() / 1024 << " kB) still resident";
+}
+
+size_t mapbuffer::resident_bytes() const
+{
+    return submaps.size() * sizeof( submap );
+}
+
+void mapbuffer::touch_quad( const tripoint_abs_sm &p )
+{
+    quad_last_used[project_to<coords::omt>( p )] = ++lookup_clock;
+}
+
 bool mapbuffer::add_submap( const tripoint_abs_sm &p, std::unique_ptr<submap> &sm )
 {
     if( submaps.count( p ) ) {
@@ -77,6 +172,7 @@ bool mapbuffer::add_submap( const tripoint_abs_sm &p, std::unique_ptr<submap> &s
     }
 
     submaps[p] = std::move( sm );
+    touch_quad( p );
 
     return true;
 }
@@ -101,6 +197,7 @@ void mapbuffer::remove_submap( const tripoint_abs_sm &addr )
         return;
     }
     submaps.erase( m_target );
+    quad_last_used.erase( project_to<coords::omt>( addr ) );
 }
 
 submap *mapbuffer::lookup_submap( const tripoint_abs_sm &p )
@@ -118,6 +215,7 @@ submap *mapbuffer::lookup_submap( const tripoint_abs_sm &p )
         return nullptr;
     }
 
+    touch_quad( p );
     return iter->second.get();
 }
 
@@ -175,9 +273,27 @@ void mapbuffer::save( bool delete_after_save )
     for( auto &elem : submaps_to_delete ) {
         remove_submap( elem );
     }
+
+    // Quads unloaded since the last save are saved now too: the ones loaded again were just
+    // written from memory, the others are moved over from the scratch directory.
+    if( !unsaved_quads.empty() ) {
+        save_writer::flush();
+        for( const tripoint_abs_omt &quad : unsaved_quads ) {
+            const cata_path unsaved_path = find_unsaved_quad_path( quad );
+            if( saved_submaps.count( quad ) == 0 ) {
+                const cata_path dirname = find_dirname( quad );
+                assure_dir_exist( dirname );
+                rename_file( unsaved_path.get_unrelative_path(),
+                             find_quad_path( dirname, quad ).get_unrelative_path() );
+            } else {
+                remove_file( unsaved_path.get_unrelative_path() );
+            }
+        }
+        unsaved_quads.clear();
+    }
 }
 
-void mapbuffer::save_quad(
+bool mapbuffer::save_quad(
     const cata_path &dirname, const cata_path &filename, const tripoint_abs_omt &om_addr,
     std::list<tripoint_abs_sm> &submaps_to_delete, bool delete_after_save )
 {
@@ -193,7 +309,8 @@ void mapbuffer::save_quad(
         tripoint_abs_sm submap_addr = project_to<coords::sm>( om_addr );
         submap_addr += offsets_offset;
         submap_addrs.push_back( submap_addr );
-        submap *sm = submaps[submap_addr].get();
+        const auto it = submaps.find( submap_addr );
+        submap *sm = it == submaps.end() ? nullptr : it->second.get();
         if( sm != nullptr && !sm->is_uniform() ) {
             all_uniform = false;
         }
@@ -203,26 +320,28 @@ void mapbuffer::save_quad(
         // Nothing to save - this quad will be regenerated faster than it would be re-read
         if( delete_after_save ) {
             for( auto &submap_addr : submap_addrs ) {
-                if( submaps.count( submap_addr ) > 0 && submaps[submap_addr] != nullptr ) {
+                const auto it = submaps.find( submap_addr );
+                if( it != submaps.end() && it->second != nullptr ) {
                     submaps_to_delete.push_back( submap_addr );
                 }
             }
         }
 
-        return;
+        return false;
     }
 
     // Don't create the directory if it would be empty
     assure_dir_exist( dirname );
-    write_to_file( filename, [&]( std::ostream & fout ) {
+    save_writer::write_to_file( filename, [&]( std::ostream & fout ) {
         JsonOut jsout( fout );
         jsout.start_array();
         for( auto &submap_addr : submap_addrs ) {
-            if( submaps.count( submap_addr ) == 0 ) {
+            const auto it = submaps.find( submap_addr );
+            if( it == submaps.end() ) {
                 continue;
             }
 
-            submap *sm = submaps[submap_addr].get();
+            submap *sm = it->second.get();
 
             if( sm == nullptr ) {
                 continue;
@@ -250,6 +369,7 @@ void mapbuffer::save_quad(
 
         jsout.end_array();
     } );
+    return true;
 }
 
 // We're reading in way too many entities here to mess around with creating sub-objects and
@@ -259,7 +379,8 @@ submap *mapbuffer::unserialize_submaps( const tripoint_abs_sm &p )
     // Map the tripoint to the submap quad that stores it.
     const tripoint_abs_omt om_addr = project_to<coords::omt>( p );
     const cata_path dirname = find_dirname( om_addr );
-    cata_path quad_path = find_quad_path( dirname, om_addr );
+    cata_path quad_path = unsaved_quads.count( om_addr ) != 0 ? find_unsaved_quad_path( om_addr ) :
+                          find_quad_path( dirname, om_addr );
 
     if( !file_exist( quad_path ) ) {
         // Fix for old saves where the path was generated using std::stringstream, which
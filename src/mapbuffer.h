@@ -2,10 +2,13 @@
 #ifndef CATA_SRC_MAPBUFFER_H
 #define CATA_SRC_MAPBUFFER_H
 
+#include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <list>
-#include <map>
 #include <memory>
+#include <set>
+#include <unordered_map>
 
 #include "coordinates.h"
 #include "point.h"
@@ -28,7 +31,7 @@ class mapbuffer
          **/
         void save( bool delete_after_save = false );
 
-        /** Delete all buffered submaps. **/
+        /** Delete all buffered submaps, and discard quads unloaded since the last save. **/
         void clear();
 
         /** Delete all buffered submaps except those inside the reality bubble.
@@ -38,6 +41,33 @@ class mapbuffer
          */
         void clear_outside_reality_bubble();
 
+        /** Save and unload submaps until at most max_submaps are left in memory.
+         *
+         * Whole quads are unloaded, the least recently looked up ones first and of those
+         * the ones farthest from the reality bubble first. Submaps inside the reality bubble
+         * are never unloaded. Quads with anything worth saving are written to a scratch
+         * directory of the world, all-uniform quads are simply dropped, like in @ref save.
+         * The next @ref save moves the written quads to the map files of the world, until then
+         * they are loaded back from the scratch directory, and quitting without saving
+         * discards them with @ref clear.
+         * Like @ref save, this must only be called when no other map than the main one
+         * references submaps.
+         */
+        void unload_least_recently_used( size_t max_submaps );
+
+        /** Number of submaps currently held in memory. */
+        size_t resident_submaps() const {
+            return submaps.size();
+        }
+        /** Rough size of the submaps in memory, not counting what their contents allocate. */
+        size_t resident_bytes() const;
+        /** Deletes the quads @ref unload_least_recently_used wrote since the last save. */
+        void discard_unsaved_quads();
+        /** Number of submaps unloaded by @ref unload_least_recently_used so far. */
+        size_t unloaded_submaps() const {
+            return num_unloaded_submaps;
+        }
+
         /** Add a new submap to the buffer.
          *
          * @param p The absolute world position in submap coordinates.
@@ -63,7 +93,7 @@ class mapbuffer
         submap *lookup_submap( const tripoint_abs_sm &p );
 
     private:
-        using submap_map_t = std::map<tripoint_abs_sm, std::unique_ptr<submap>>;
+        using submap_map_t = std::unordered_map<tripoint_abs_sm, std::unique_ptr<submap>>;
 
     public:
         inline submap_map_t::iterator begin() {
@@ -77,13 +107,21 @@ class mapbuffer
         // There's a very good reason this is private,
         // if not handled carefully, this can erase in-use submaps and crash the game.
         void remove_submap( const tripoint_abs_sm &addr );
+        void touch_quad( const tripoint_abs_sm &p );
         submap *unserialize_submaps( const tripoint_abs_sm &p );
         void deserialize( const JsonArray &ja );
-        void save_quad(
+        /** @returns Whether anything was written, all-uniform quads are not. */
+        bool save_quad(
             const cata_path &dirname, const cata_path &filename,
             const tripoint_abs_omt &om_addr, std::list<tripoint_abs_sm> &submaps_to_delete,
             bool delete_after_save );
         submap_map_t submaps; // NOLINT(cata-serialize)
+        // When each quad was last looked up, in lookups since the start of the session
+        std::unordered_map<tripoint_abs_omt, uint64_t> quad_last_used; // NOLINT(cata-serialize)
+        uint64_t lookup_clock = 0; // NOLINT(cata-serialize)
+        size_t num_unloaded_submaps = 0; // NOLINT(cata-serialize)
+        // Quads unload_least_recently_used wrote to the scratch directory since the last save
+        std::set<tripoint_abs_omt> unsaved_quads; // NOLINT(cata-serialize)
 };
 
 extern mapbuffer MAPBUFFER;
@@ -36,6 +36,9 @@ const units::volume DEFAULT_MAX_VOLUME_IN_SQUARE = units::from_liter( 1000 );
 generic_factory<ter_t> terrain_data( "terrain" );
 generic_factory<furn_t> furniture_data( "furniture" );
 
+map_data_property_table ter_property_table;
+map_data_property_table furn_property_table;
+
 } // namespace
 
 /** @relates int_id */
@@ -674,6 +677,7 @@ void map_data_common_t::extraprocess_flags( const ter_furn_flag flag )
 void map_data_common_t::set_flag( const std::string &flag )
 {
     flags.insert( flag );
+    interned_flags.set( interned_flag( flag ) );
     std::optional<ter_furn_flag> f = io::string_to_enum_optional<ter_furn_flag>( flag );
     if( f.has_value() ) {
         bitflags.set( f.value() );
@@ -683,11 +687,18 @@ void map_data_common_t::set_flag( const std::string &flag )
 
 void map_data_common_t::set_flag( const ter_furn_flag flag )
 {
-    flags.insert( io::enum_to_string<ter_furn_flag>( flag ) );
+    const std::string flag_str = io::enum_to_string<ter_furn_flag>( flag );
+    flags.insert( flag_str );
+    interned_flags.set( interned_flag( flag_str ) );
     bitflags.set( flag );
     extraprocess_flags( flag );
 }
 
+void map_data_common_t::intern_flags()
+{
+    interned_flags.assign( flags );
+}
+
 void map_data_common_t::set_connect_groups( const std::vector<std::string>
         &connect_groups_vec )
 {
@@ -1153,13 +1164,45 @@ void set_ter_ids()
         } else {
             ter.trap = trap_str_id( ter.trap_id_str );
         }
+        ter.intern_flags();
+    }
+
+    ter_property_table.clear();
+    for( const ter_t &ter : terrain_data.get_all() ) {
+        ter_property_table.add( ter );
     }
 }
 
+void map_data_property_table::clear()
+{
+    flags.clear();
+    movecost.clear();
+    transparent.clear();
+}
+
+void map_data_property_table::add( const map_data_common_t &type )
+{
+    flags.push_back( type.get_flag_bits() );
+    movecost.push_back( type.movecost );
+    transparent.push_back( type.transparent );
+}
+
+const map_data_property_table &ter_properties()
+{
+    return ter_property_table;
+}
+
+const map_data_property_table &furn_properties()
+{
+    return furn_property_table;
+}
+
 void reset_furn_ter()
 {
     terrain_data.reset();
     furniture_data.reset();
+    ter_property_table.clear();
+    furn_property_table.clear();
 }
 
 furn_id f_null, f_clear,
@@ -1324,6 +1367,12 @@ void set_furn_ids()
     f_wooden_flagpole = furn_id( "f_wooden_flagpole" );
     f_console_broken = furn_id( "f_console_broken" );
     f_console = furn_id( "f_console" );
+
+    furn_property_table.clear();
+    for( const furn_t &furn : furniture_data.get_all() ) {
+        const_cast<furn_t &>( furn ).intern_flags();
+        furn_property_table.add( furn );
+    }
 }
 
 size_t ter_t::count()
@@ -5,6 +5,7 @@
 #include <array>
 #include <bitset>
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <set>
 #include <string>
@@ -15,6 +16,7 @@
 #include "color.h"
 #include "enum_bitset.h"
 #include "iexamine.h"
+#include "interned_flag.h"
 #include "translations.h"
 #include "type_id.h"
 #include "units.h"
@@ -455,6 +457,7 @@ struct map_data_common_t {
     private:
         std::set<std::string> flags;    // string flags which possibly refer to what's documented above.
         enum_bitset<ter_furn_flag> bitflags; // bitfield of -certain- string flags which are heavily checked
+        interned_flag_set interned_flags; // all the string flags, by interned index
 
     public:
         ter_str_id curtain_transform;
@@ -522,6 +525,17 @@ struct map_data_common_t {
             return bitflags[flag];
         }
 
+        bool has_flag( const interned_flag &flag ) const {
+            return interned_flags.has( flag );
+        }
+
+        /** Rebuilds the interned flags from the string flags, called once all data is loaded. */
+        void intern_flags();
+
+        const enum_bitset<ter_furn_flag> &get_flag_bits() const {
+            return bitflags;
+        }
+
         void extraprocess_flags( ter_furn_flag flag );
 
         void set_flag( const std::string &flag );
@@ -617,6 +631,23 @@ void set_ter_ids();
 void set_furn_ids();
 void reset_furn_ter();
 
+/**
+ * Properties the map caches are built from, for all terrain or all furniture types, in arrays
+ * indexed by int id. Scanning the ids of a submap then only reads these small arrays rather than
+ * the whole ter_t / furn_t objects. Filled in by set_ter_ids() and set_furn_ids().
+ */
+struct map_data_property_table {
+    std::vector<enum_bitset<ter_furn_flag>> flags;
+    std::vector<int> movecost;
+    std::vector<std::uint8_t> transparent;
+
+    void clear();
+    void add( const map_data_common_t &type );
+};
+
+const map_data_property_table &ter_properties();
+const map_data_property_table &furn_properties();
+
 /*
  * The terrain list contains the master list of  information and metadata for a given type of terrain.
  */
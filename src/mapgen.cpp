@@ -1468,6 +1468,13 @@ class mapgen_value
         Id get( const mapgendata &dat ) const {
             return source_->get( dat );
         }
+        /** The value, if it is always the same, regardless of parameters and randomness. */
+        std::optional<Id> constant_value() const {
+            if( const id_source *constant = dynamic_cast<const id_source *>( source_.get() ) ) {
+                return constant->id;
+            }
+            return std::nullopt;
+        }
         std::vector<StringId> all_possible_results( const mapgen_parameters &params ) const {
             return source_->all_possible_results( params );
         }
@@ -2764,7 +2771,11 @@ class jmapgen_furniture : public jmapgen_piece
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            if( !dat.m.furn_set( point( x.get(), y.get() ), chosen_id ) ) {
+            place( dat, point( x.get(), y.get() ), chosen_id, context );
+        }
+        static void place( const mapgendata &dat, const point &p, const furn_id &chosen_id,
+                           const std::string &context ) {
+            if( !dat.m.furn_set( p, chosen_id ) ) {
                 debugmsg( "Problem setting furniture in %s", context );
             }
         }
@@ -2789,6 +2800,12 @@ class jmapgen_terrain : public jmapgen_piece
             act_unknown, act_ignore, act_dismantle, act_erase
         };
     public:
+        /** What to do with furniture, traps and items in the way, depends only on the flags. */
+        struct clearing {
+            apply_action furn = apply_action::act_unknown;
+            apply_action trap = apply_action::act_unknown;
+            apply_action item = apply_action::act_unknown;
+        };
         mapgen_value<ter_id> id;
         jmapgen_terrain( const JsonObject &jsi, const std::string_view/*context*/ ) :
             jmapgen_terrain( jsi.get_member( "ter" ) ) {}
@@ -2807,15 +2824,11 @@ class jmapgen_terrain : public jmapgen_piece
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            point p( x.get(), y.get() );
-            tripoint tp( p, dat.m.get_abs_sub().z() );
-
-            ter_id terrain_here = dat.m.ter( p );
-            const ter_t &chosen_ter = *chosen_id;
-            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
-            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
-            const bool is_boring_wall = is_wall && !place_item;
+            place( dat, point( x.get(), y.get() ), chosen_id, get_clearing( dat, context ),
+                   context );
+        }
 
+        static clearing get_clearing( const mapgendata &dat, const std::string &context ) {
             apply_action act_furn = apply_action::act_unknown;
             apply_action act_trap = apply_action::act_unknown;
             apply_action act_item = apply_action::act_unknown;
@@ -2863,6 +2876,21 @@ class jmapgen_terrain : public jmapgen_piece
                           "mistake, as any dismantle outputs will not be preserved.",
                           context, dat.terrain_type().id().str() );
             }
+            return { act_furn, act_trap, act_item };
+        }
+
+        static void place( const mapgendata &dat, const point &p, const ter_id &chosen_id,
+                           const clearing &clear, const std::string &context ) {
+            const apply_action act_furn = clear.furn;
+            const apply_action act_trap = clear.trap;
+            const apply_action act_item = clear.item;
+            tripoint tp( p, dat.m.get_abs_sub().z() );
+
+            ter_id terrain_here = dat.m.ter( p );
+            const ter_t &chosen_ter = *chosen_id;
+            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
+            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
+            const bool is_boring_wall = is_wall && !place_item;
 
             if( is_boring_wall || act_furn == apply_action::act_erase ) {
                 dat.m.furn_clear( p );
@@ -3687,6 +3715,8 @@ class jmapgen_nested : public jmapgen_piece
         }
 };
 
+bool jmapgen_objects::use_static_layers = true;
+
 jmapgen_objects::jmapgen_objects( const point &offset, const point &mapsize, const point &tot_size )
     : m_offset( offset )
     , mapgensize( mapsize )
@@ -4545,6 +4575,80 @@ std::unordered_set<point> nested_mapgen::all_placement_coords() const
 void jmapgen_objects::finalize()
 {
     std::stable_sort( objects.begin(), objects.end(), compare_phases );
+
+    in_static_layer.assign( objects.size(), false );
+    build_static_layer<jmapgen_terrain>( mapgen_phase::terrain, static_terrain );
+    build_static_layer<jmapgen_furniture>( mapgen_phase::furniture, static_furniture );
+}
+
+template<typename PieceType, typename Id>
+void jmapgen_objects::build_static_layer( const mapgen_phase phase, static_layer<Id> &layer )
+{
+    // Beyond that many points an object outside the layer counts as placing anywhere.
+    static constexpr int max_footprint = 1024;
+
+    layer = static_layer<Id>();
+    std::vector<std::pair<point, Id>> placed;
+    // Points taken by the layer, and points objects outside of it may place something on.
+    std::unordered_set<point> taken;
+    std::unordered_set<point> blocked;
+    auto range = std::equal_range( objects.begin(), objects.end(), phase, compare_phases );
+    for( auto it = range.first; it != range.second; ++it ) {
+        const jmapgen_place &where = it->first;
+        const PieceType *piece = dynamic_cast<const PieceType *>( it->second.get() );
+        if( !piece ) {
+            // Other pieces may place anything anywhere.
+            break;
+        }
+        const std::optional<Id> id = piece->id.constant_value();
+        if( id && id->id().is_null() ) {
+            // Places nothing and draws no random numbers, wherever it is.
+            in_static_layer[it - objects.begin()] = true;
+            continue;
+        }
+        const jmapgen_int &repeat = piece->repeat;
+        const point p( where.x.val, where.y.val );
+        if( id && where.x.val == where.x.valmax && where.y.val == where.y.valmax &&
+            where.repeat.val == 1 && where.repeat.valmax == 1 &&
+            repeat.val == 1 && repeat.valmax == 1 &&
+            !taken.count( p ) && !blocked.count( p ) ) {
+            in_static_layer[it - objects.begin()] = true;
+            taken.insert( p );
+            placed.emplace_back( p, *id );
+            continue;
+        }
+        const point min( std::min( where.x.val, where.x.valmax ),
+                         std::min( where.y.val, where.y.valmax ) );
+        const point max( std::max( where.x.val, where.x.valmax ),
+                         std::max( where.y.val, where.y.valmax ) );
+        if( ( max.x - min.x + 1 ) * ( max.y - min.y + 1 ) > max_footprint ) {
+            break;
+        }
+        for( int x = min.x; x <= max.x; x++ ) {
+            for( int y = min.y; y <= max.y; y++ ) {
+                blocked.emplace( x, y );
+            }
+        }
+    }
+    if( placed.empty() ) {
+        return;
+    }
+
+    point min = placed.front().first;
+    point max = min;
+    for( const std::pair<point, Id> &elem : placed ) {
+        min.x = std::min( min.x, elem.first.x );
+        min.y = std::min( min.y, elem.first.y );
+        max.x = std::max( max.x, elem.first.x );
+        max.y = std::max( max.y, elem.first.y );
+    }
+    layer.origin = min;
+    layer.size = max - min + point_south_east;
+    layer.ids.resize( static_cast<size_t>( layer.size.x ) * layer.size.y );
+    for( const std::pair<point, Id> &elem : placed ) {
+        const point rel = elem.first - min;
+        layer.ids[static_cast<size_t>( rel.y ) * layer.size.x + rel.x] = elem.second;
+    }
 }
 
 void jmapgen_objects::check( const std::string &context, const mapgen_parameters &parameters ) const
@@ -5062,7 +5166,36 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase, const po
 
     auto range_at_phase = std::equal_range( objects.begin(), objects.end(), phase, compare_phases );
 
+    // Only once finalized
+    const bool static_layers = use_static_layers && in_static_layer.size() == objects.size();
+    if( static_layers && phase == mapgen_phase::terrain && !static_terrain.ids.empty() ) {
+        const jmapgen_terrain::clearing clear = jmapgen_terrain::get_clearing( dat, context );
+        const point origin = static_terrain.origin - offset;
+        for( int y = 0; y < static_terrain.size.y; y++ ) {
+            for( int x = 0; x < static_terrain.size.x; x++ ) {
+                const std::optional<ter_id> &id = static_terrain.ids[y * static_terrain.size.x + x];
+                if( id ) {
+                    jmapgen_terrain::place( dat, origin + point( x, y ), *id, clear, context );
+                }
+            }
+        }
+    } else if( static_layers && phase == mapgen_phase::furniture ) {
+        const point origin = static_furniture.origin - offset;
+        for( int y = 0; y < static_furniture.size.y; y++ ) {
+            for( int x = 0; x < static_furniture.size.x; x++ ) {
+                const std::optional<furn_id> &id =
+                    static_furniture.ids[y * static_furniture.size.x + x];
+                if( id ) {
+                    jmapgen_furniture::place( dat, origin + point( x, y ), *id, context );
+                }
+            }
+        }
+    }
+
     for( auto it = range_at_phase.first; it != range_at_phase.second; ++it ) {
+        if( static_layers && in_static_layer[it - objects.begin()] ) {
+            continue;
+        }
         const jmapgen_obj &obj = *it;
         jmapgen_place where = obj.first;
         where.offset( -offset );
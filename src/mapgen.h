@@ -413,12 +413,38 @@ struct jmapgen_objects {
          **/
         bool has_vehicle_collision( const mapgendata &dat, const point &offset ) const;
 
+        /** Whether @ref apply uses the static layers, tests turn it off to compare. */
+        static bool use_static_layers;
+
     private:
         /**
          * Combination of where to place something and what to place.
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+        /**
+         * The ids placed by the objects of one phase that place the same id on the same point
+         * every time (usually most of the "rows"), as a grid covering those points.
+         * Empty where nothing is placed.
+         */
+        template<typename Id>
+        struct static_layer {
+            point origin;
+            point size;
+            std::vector<std::optional<Id>> ids;
+        };
+        /**
+         * Built by @ref finalize. Applying a phase places its layer first, then the objects
+         * not in the layer in their order. An object only goes into the layer if none of the
+         * objects before it that stay out of it can place anything on its point, so the
+         * result is the same as applying all of them in order.
+         */
+        static_layer<ter_id> static_terrain;
+        static_layer<furn_id> static_furniture;
+        /** By index in @ref objects, the objects the static layers stand in for. */
+        std::vector<bool> in_static_layer;
+        template<typename PieceType, typename Id>
+        void build_static_layer( mapgen_phase phase, static_layer<Id> &layer );
         point m_offset;
         point mapgensize;
         point total_size;
@@ -0,0 +1,125 @@
+#include "mapgen_prefetch.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <optional>
+
+#include "avatar.h"
+#include "debug.h"
+#include "game_constants.h"
+#include "map.h"
+#include "mapbuffer.h"
+
+#define dbg(x) DebugLog((x),D_MAP) << __FILE__ << ":" << __LINE__ << ": "
+
+namespace mapgen_prefetch
+{
+
+std::vector<point_abs_omt> predict( const tripoint_abs_sm &bubble_origin, const point &dir,
+                                    const int depth )
+{
+    std::vector<point_abs_omt> result;
+    if( dir == point_zero || depth <= 0 ) {
+        return result;
+    }
+    const point_abs_omt lo = project_to<coords::omt>( bubble_origin.xy() );
+    const point_abs_omt hi = project_to<coords::omt>( bubble_origin.xy() +
+                             point( MAPSIZE - 1, MAPSIZE - 1 ) );
+    // On each axis, the range the bubble covers, extended by depth in the direction of movement.
+    const int min_x = dir.x < 0 ? lo.x() - depth : lo.x();
+    const int max_x = dir.x > 0 ? hi.x() + depth : hi.x();
+    const int min_y = dir.y < 0 ? lo.y() - depth : lo.y();
+    const int max_y = dir.y > 0 ? hi.y() + depth : hi.y();
+    for( int x = min_x; x <= max_x; x++ ) {
+        for( int y = min_y; y <= max_y; y++ ) {
+            if( x < lo.x() || x > hi.x() || y < lo.y() || y > hi.y() ) {
+                result.emplace_back( x, y );
+            }
+        }
+    }
+    const point_abs_omt center = project_to<coords::omt>( bubble_origin.xy() +
+                                 point( HALF_MAPSIZE, HALF_MAPSIZE ) );
+    std::stable_sort( result.begin(), result.end(),
+    [&center]( const point_abs_omt & l, const point_abs_omt & r ) {
+        return square_dist( l, center ) < square_dist( r, center );
+    } );
+    return result;
+}
+
+// Where the player was on the previous call of update()
+static std::optional<tripoint_abs_ms> last_pos;
+// What the queue was built for
+static tripoint_abs_sm queued_origin;
+static point queued_dir;
+static int queued_depth = 0;
+// Overmap terrains still to check, the next one last
+static std::vector<tripoint_abs_omt> queue;
+
+static void build_queue( const tripoint_abs_sm &origin, const point &dir, const int depth,
+                         const int player_z )
+{
+    queued_origin = origin;
+    queued_dir = dir;
+    queued_depth = depth;
+    queue.clear();
+    const std::vector<point_abs_omt> columns = predict( origin, dir, depth );
+    // The player's z-level first, then the ones further away from it
+    std::vector<int> levels;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        levels.push_back( z );
+    }
+    std::stable_sort( levels.begin(), levels.end(), [player_z]( const int l, const int r ) {
+        return std::abs( l - player_z ) < std::abs( r - player_z );
+    } );
+    for( const int z : levels ) {
+        for( const point_abs_omt &p : columns ) {
+            queue.emplace_back( p, z );
+        }
+    }
+    std::reverse( queue.begin(), queue.end() );
+}
+
+int update( const int budget )
+{
+    const tripoint_abs_ms pos = get_avatar().get_location();
+    const std::optional<tripoint_abs_ms> prev = last_pos;
+    last_pos = pos;
+    if( budget <= 0 || !prev ) {
+        queue.clear();
+        queued_depth = 0;
+        return 0;
+    }
+    const point moved = ( pos - *prev ).raw().xy();
+    const int speed = std::max( std::abs( moved.x ), std::abs( moved.y ) );
+    // Teleports are not going to continue.
+    if( speed > MAPSIZE_X ) {
+        queue.clear();
+        queued_depth = 0;
+        return 0;
+    }
+    // When standing still, keep working on the previous prediction.
+    if( speed != 0 ) {
+        const point dir( moved.x > 0 ? 1 : moved.x < 0 ? -1 : 0,
+                         moved.y > 0 ? 1 : moved.y < 0 ? -1 : 0 );
+        // Look about 5 turns ahead, fast vehicles cover a few overmap terrains in that time.
+        const int depth = std::clamp( speed * 5 / ( 2 * SEEX ) + 1, 1, 4 );
+        const tripoint_abs_sm origin = get_map().get_abs_sub();
+        if( origin != queued_origin || dir != queued_dir || depth != queued_depth ) {
+            build_queue( origin, dir, depth, pos.z() );
+        }
+    }
+
+    int generated = 0;
+    while( generated < budget && !queue.empty() ) {
+        const tripoint_abs_omt omt = queue.back();
+        queue.pop_back();
+        if( MAPBUFFER.lookup_submap( project_to<coords::sm>( omt ) ) == nullptr ) {
+            generate_omt( omt );
+            dbg( D_INFO ) << "prefetched " << omt.to_string();
+            generated++;
+        }
+    }
+    return generated;
+}
+
+} // namespace mapgen_prefetch
@@ -0,0 +1,37 @@
+#pragma once
+#ifndef CATA_SRC_MAPGEN_PREFETCH_H
+#define CATA_SRC_MAPGEN_PREFETCH_H
+
+#include <vector>
+
+#include "coordinates.h"
+#include "point.h"
+
+/**
+ * Generates the overmap terrain the player is heading for before the reality bubble reaches it,
+ * a few at a time, so that shifting the map does not have to run mapgen for a whole edge of the
+ * bubble at once.
+ */
+namespace mapgen_prefetch
+{
+
+/**
+ * Overmap terrain columns just beyond the edge of the reality bubble (whose corner is at
+ * bubble_origin) in direction dir, up to depth of them deep, nearest to the bubble first.
+ * dir components are -1, 0 or 1.
+ */
+std::vector<point_abs_omt> predict( const tripoint_abs_sm &bubble_origin, const point &dir,
+                                    int depth );
+
+/**
+ * To be called once per turn. Predicts where the player goes from their movement since the last
+ * call, and generates (or loads from disk) at most budget of the overmap terrains in the predicted
+ * columns that are not in the mapbuffer yet, those on the player's z-level first. The rest are
+ * left for the following calls, until the prediction changes.
+ * @returns The number of overmap terrains that were generated.
+ */
+int update( int budget );
+
+} // namespace mapgen_prefetch
+
+#endif // CATA_SRC_MAPGEN_PREFETCH_H
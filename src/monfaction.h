@@ -43,6 +43,11 @@ const std::vector<monfaction> &get_all();
 void reset();
 void finalize();
 void load_monster_faction( const JsonObject &jo, const std::string &src );
+/**
+ * Attitude of faction `from` towards faction `to`, same as `from->attitude( to )`, but read from
+ * a matrix of all factions' attitudes instead of going through the faction objects.
+ */
+mf_attitude attitude( const mfaction_id &from, const mfaction_id &to );
 } // namespace monfactions
 
 class monfaction
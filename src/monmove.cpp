@@ -335,23 +335,24 @@ struct monster_plan {
 };
 
 monster_plan::monster_plan( const monster &mon ) :
-    angers_hostile_weak( mon.type->has_anger_trigger( mon_trigger::HOSTILE_WEAK ) ),
-    fears_hostile_weak( mon.type->has_fear_trigger( mon_trigger::HOSTILE_WEAK ) ),
-    placate_hostile_weak( mon.type->has_placate_trigger( mon_trigger::HOSTILE_WEAK ) ),
-    angers_hostile_near( mon.type->has_anger_trigger( mon_trigger::HOSTILE_CLOSE ) ? 5 : 0 ),
-    angers_hostile_seen( mon.type->has_anger_trigger( mon_trigger::HOSTILE_SEEN ) ? rng( 0, 2 ) : 0 ),
-    angers_mating_season( mon.type->has_anger_trigger( mon_trigger::MATING_SEASON ) ? 3 : 0 ),
-    angers_cub_threatened( mon.type->has_anger_trigger( mon_trigger::PLAYER_NEAR_BABY ) ? 8 : 0 ),
-    fears_hostile_near( mon.type->has_fear_trigger( mon_trigger::HOSTILE_CLOSE ) ? 5 : 0 ),
-    fears_hostile_seen( mon.type->has_fear_trigger( mon_trigger::HOSTILE_SEEN ) ? rng( 0, 2 ) : 0 )
+    angers_hostile_weak( mon.type->plan_profile.angers_hostile_weak ),
+    fears_hostile_weak( mon.type->plan_profile.fears_hostile_weak ),
+    placate_hostile_weak( mon.type->plan_profile.placate_hostile_weak ),
+    angers_hostile_near( mon.type->plan_profile.angers_hostile_near ),
+    angers_hostile_seen( mon.type->plan_profile.angers_hostile_seen ? rng( 0, 2 ) : 0 ),
+    angers_mating_season( mon.type->plan_profile.angers_mating_season ),
+    angers_cub_threatened( mon.type->plan_profile.angers_cub_threatened ),
+    fears_hostile_near( mon.type->plan_profile.fears_hostile_near ),
+    fears_hostile_seen( mon.type->plan_profile.fears_hostile_seen ? rng( 0, 2 ) : 0 )
 {
-    smart_planning = mon.has_flag( MF_PRIORITIZE_TARGETS );
-    max_sight_range = std::max( mon.type->vision_day, mon.type->vision_night );
+    const mtype_plan_profile &profile = mon.type->plan_profile;
+    smart_planning = profile.smart_planning;
+    max_sight_range = profile.max_sight_range;
     dist = !smart_planning ? max_sight_range : 8.6f;
     fleeing = false;
     docile = mon.friendly != 0 && mon.has_effect( effect_docile );
-    swarms = mon.has_flag( MF_SWARMS );
-    group_morale = mon.has_flag( MF_GROUP_MORALE ) && mon.morale < mon.type->morale;
+    swarms = profile.swarms;
+    group_morale = profile.group_morale && mon.morale < mon.type->morale;
 }
 
 void monster::anger_hostile_seen( const monster_plan &mon_plan )
@@ -388,7 +389,7 @@ void monster::anger_mating_season( const monster_plan &mon_plan )
 
 void monster::anger_cub_threatened( monster_plan &mon_plan )
 {
-    if( mon_plan.angers_cub_threatened < 0 ) {
+    if( mon_plan.angers_cub_threatened < 0 || !type->plan_profile.has_baby_monster ) {
         // return early, not angered by cubs being threatened
         return;
     }
@@ -411,18 +412,7 @@ void monster::anger_cub_threatened( monster_plan &mon_plan )
 
 bool monster::mating_angry() const
 {
-    bool mating_angry = false;
-    season_type season = season_of_year( calendar::turn );
-    for( const std::string &elem : type->baby_flags ) {
-        if( ( season == SUMMER && elem == "SUMMER" ) ||
-            ( season == WINTER && elem == "WINTER" ) ||
-            ( season == SPRING && elem == "SPRING" ) ||
-            ( season == AUTUMN && elem == "AUTUMN" ) ) {
-            mating_angry = true;
-            break;
-        }
-    }
-    return mating_angry;
+    return type->plan_profile.mating_seasons.test( season_of_year( calendar::turn ) );
 }
 
 void monster::plan()
@@ -482,7 +472,7 @@ void monster::plan()
 
     int valid_targets = ( mon_plan.target == nullptr ) ? 0 : 1;
     for( npc &who : g->all_npcs() ) {
-        mf_attitude faction_att = faction.obj().attitude( who.get_monster_faction() );
+        mf_attitude faction_att = monfactions::attitude( faction, who.get_monster_faction() );
         if( faction_att == MFA_NEUTRAL || faction_att == MFA_FRIENDLY ) {
             continue;
         }
@@ -540,7 +530,7 @@ void monster::plan()
     int turns_to_skip = max_turns_to_skip * rate_limiting_factor;
     if( friendly == 0 && ( turns_to_skip == 0 || turns_since_target % turns_to_skip == 0 ) ) {
         for( const auto &fac_list : factions ) {
-            mf_attitude faction_att = faction.obj().attitude( fac_list.first );
+            mf_attitude faction_att = monfactions::attitude( faction, fac_list.first );
             if( faction_att == MFA_NEUTRAL || faction_att == MFA_FRIENDLY ) {
                 continue;
             }
@@ -633,7 +623,7 @@ void monster::plan()
     }
 
     // Operating monster keep you safe while they operate, how nice....
-    if( type->has_special_attack( "OPERATE" ) ) {
+    if( type->plan_profile.operates ) {
         if( has_effect( effect_operating ) ) {
             friendly = 100;
             for( Creature *critter : here.get_creatures_in_radius( pos(), 6 ) ) {
@@ -649,7 +639,7 @@ void monster::plan()
 
     if( has_effect( effect_dragging ) ) {
 
-        if( type->has_special_attack( "OPERATE" ) ) {
+        if( type->plan_profile.operates ) {
 
             bool found_path_to_couch = false;
             tripoint tmp( pos() + point( 12, 12 ) );
@@ -1227,7 +1217,7 @@ void monster::nursebot_operate( Character *dragged_foe )
     }
 
     // Nothing to do if they can't operate, or they don't think they're dragging.
-    if( !( type->has_special_attack( "OPERATE" ) && has_effect( effect_dragging ) ) ) {
+    if( !( type->plan_profile.operates && has_effect( effect_dragging ) ) ) {
         return;
     }
 
@@ -1307,7 +1307,7 @@ Creature::Attitude monster::attitude_to( const Creature &other ) const
             return Attitude::FRIENDLY;
         }
 
-        mf_attitude faction_att = faction.obj().attitude( m->faction );
+        mf_attitude faction_att = monfactions::attitude( faction, m->faction );
         if( ( friendly != 0 && m->friendly != 0 ) ||
             ( friendly == 0 && m->friendly == 0 && faction_att == MFA_FRIENDLY ) ) {
             // Friendly (to player) monsters are friendly to each other
@@ -2005,6 +2005,7 @@ void monster::apply_damage( Creature *source, bodypart_id /*bp*/, int dam,
         return;
     }
     hp -= dam;
+    ai_lod_stimulus = true;
     if( hp < 1 ) {
         set_killer( source );
     } else if( dam > 0 ) {
@@ -14,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "ai_lod.h"
 #include "calendar.h"
 #include "character_id.h"
 #include "color.h"
@@ -503,6 +504,10 @@ class monster : public Creature
         tripoint_abs_ms wander_pos; // Wander destination - Just try to move in that direction
         bool provocative_sound = false; // Are we wandering toward something we think is alive?
         int wandf = 0;       // Urge to is_wandering - Increased by sound, decrements each move
+        // Turns in a row this monster did not act because it was idle and far away, see ai_lod
+        int ai_lod_skipped = 0; // NOLINT(cata-serialize)
+        // Something happened that this monster has to react to on its next turn, see ai_lod
+        bool ai_lod_stimulus = false; // NOLINT(cata-serialize)
         std::vector<item> inv; // Inventory
         std::vector<item> dissectable_inv; // spawned at death, tracked for respawn/dissection
         Character *mounted_player = nullptr; // player that is mounting this creature
@@ -613,6 +618,8 @@ class monster : public Creature
         std::bitset<NUM_MEFF> effect_cache;
         int turns_since_target = 0;
 
+        friend bool ai_lod::should_act( monster &, const std::vector<tripoint> &, int );
+
         Character *find_dragged_foe();
         void nursebot_operate( Character *dragged_foe );
 
@@ -467,6 +467,7 @@ void MonsterGenerator::finalize_mtypes()
 
         build_behavior_tree( mon );
         finalize_pathfinding_settings( mon );
+        finalize_plan_profile( mon );
 
         mon.weakpoints.clear();
         for( const weakpoints_id &wpset : mon.weakpoints_deferred ) {
@@ -526,6 +527,38 @@ void MonsterGenerator::finalize_pathfinding_settings( mtype &mon )
     }
 }
 
+void MonsterGenerator::finalize_plan_profile( mtype &mon )
+{
+    mtype_plan_profile &profile = mon.plan_profile;
+    profile.angers_hostile_weak = mon.has_anger_trigger( mon_trigger::HOSTILE_WEAK );
+    profile.fears_hostile_weak = mon.has_fear_trigger( mon_trigger::HOSTILE_WEAK );
+    profile.placate_hostile_weak = mon.has_placate_trigger( mon_trigger::HOSTILE_WEAK );
+    profile.angers_hostile_seen = mon.has_anger_trigger( mon_trigger::HOSTILE_SEEN );
+    profile.fears_hostile_seen = mon.has_fear_trigger( mon_trigger::HOSTILE_SEEN );
+    profile.angers_hostile_near = mon.has_anger_trigger( mon_trigger::HOSTILE_CLOSE ) ? 5 : 0;
+    profile.angers_mating_season = mon.has_anger_trigger( mon_trigger::MATING_SEASON ) ? 3 : 0;
+    profile.angers_cub_threatened = mon.has_anger_trigger( mon_trigger::PLAYER_NEAR_BABY ) ? 8 : 0;
+    profile.fears_hostile_near = mon.has_fear_trigger( mon_trigger::HOSTILE_CLOSE ) ? 5 : 0;
+    profile.smart_planning = mon.has_flag( MF_PRIORITIZE_TARGETS );
+    profile.swarms = mon.has_flag( MF_SWARMS );
+    profile.group_morale = mon.has_flag( MF_GROUP_MORALE );
+    profile.operates = mon.has_special_attack( "OPERATE" );
+    profile.has_baby_monster = !mon.baby_monster.is_null();
+    profile.max_sight_range = std::max( mon.vision_day, mon.vision_night );
+    profile.mating_seasons.reset();
+    for( const std::string &elem : mon.baby_flags ) {
+        if( elem == "SPRING" ) {
+            profile.mating_seasons.set( SPRING );
+        } else if( elem == "SUMMER" ) {
+            profile.mating_seasons.set( SUMMER );
+        } else if( elem == "AUTUMN" ) {
+            profile.mating_seasons.set( AUTUMN );
+        } else if( elem == "WINTER" ) {
+            profile.mating_seasons.set( WINTER );
+        }
+    }
+}
+
 void MonsterGenerator::init_phases()
 {
     phase_map["NULL"] = phase_id::PNULL;
@@ -99,6 +99,7 @@ class MonsterGenerator
         void apply_species_attributes( mtype &mon );
         void validate_species_ids( mtype &mon );
         void finalize_pathfinding_settings( mtype &mon );
+        void finalize_plan_profile( mtype &mon );
 
         friend class string_id<mtype>;
         friend class string_id<species_type>;
@@ -262,6 +262,33 @@ struct mount_item_data {
     itype_id storage;
 };
 
+/**
+ * What @ref monster::plan needs to know about a monster type every turn, derived once from its
+ * triggers, flags and special attacks when the type is finalized.
+ */
+struct mtype_plan_profile {
+    bool angers_hostile_weak = false;
+    bool fears_hostile_weak = false;
+    bool placate_hostile_weak = false;
+    bool angers_hostile_seen = false;
+    bool fears_hostile_seen = false;
+    int angers_hostile_near = 0;
+    int angers_mating_season = 0;
+    int angers_cub_threatened = 0;
+    int fears_hostile_near = 0;
+    // MF_PRIORITIZE_TARGETS
+    bool smart_planning = false;
+    bool swarms = false;
+    bool group_morale = false;
+    // Has the OPERATE special attack
+    bool operates = false;
+    // Has a baby_monster, which may have to be protected
+    bool has_baby_monster = false;
+    int max_sight_range = 0;
+    // Seasons listed in baby_flags
+    enum_bitset<season_type> mating_seasons;
+};
+
 struct mtype {
     private:
         friend class MonsterGenerator;
@@ -468,6 +495,8 @@ struct mtype {
 
         pathfinding_settings path_settings;
 
+        mtype_plan_profile plan_profile;
+
         // All the bools together for space efficiency
         //
         // Monster regenerates very quickly in poorly lit tiles.
@@ -1617,6 +1617,21 @@ void options_manager::add_options_general()
            );
 
         get_option( "AUTOSAVE_MINUTES" ).setPrerequisite( "AUTOSAVE" );
+
+        add( "RESIDENT_SUBMAPS", page_id, to_translation( "Map submaps kept in memory" ),
+             to_translation( "Number of map submaps (12x12 tiles on one z-level) kept in memory.  Beyond that, the least recently visited ones away from the player are saved and unloaded.  Each takes up about 30 kB or more.  0 keeps everything until the next save." ),
+             0, 1000000, 16384
+           );
+
+        add( "MAPGEN_PREFETCH", page_id, to_translation( "Map areas generated ahead" ),
+             to_translation( "Number of overmap terrains ahead of the player that may be generated each turn, before they come into view.  Spreads the cost of generating new areas while traveling over several turns.  0 disables it." ),
+             0, 16, 1
+           );
+
+        add( "AI_LOD_INTERVAL", page_id, to_translation( "Distant monster thinking interval" ),
+             to_translation( "Monsters that are idle and far out of sight of the player and NPCs only plan and move every this many turns at most, keeping their movement points for then.  The interval grows with the distance.  1 makes every monster act every turn." ),
+             1, 8, 4
+           );
     } );
 
     add_empty_line();
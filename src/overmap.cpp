@@ -11,6 +11,7 @@
 #include <optional>
 #include <ostream>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -54,6 +55,7 @@
 #include "regional_settings.h"
 #include "rng.h"
 #include "rotatable_symbols.h"
+#include "save_writer.h"
 #include "sets_intersect.h"
 #include "simple_pathfinding.h"
 #include "string_formatter.h"
@@ -3900,7 +3902,8 @@ void mongroup::wander( const overmap &om )
 void overmap::move_hordes()
 {
     // Prevent hordes to be moved twice by putting them in here after moving.
-    decltype( zg ) tmpzg;
+    // The map nodes are moved out and back in, so the hordes and their monsters aren't copied.
+    std::vector<decltype( zg )::node_type> moved;
     //MOVE ZOMBIE GROUPS
     for( auto it = zg.begin(); it != zg.end(); ) {
         mongroup &mg = it->second;
@@ -3956,17 +3959,34 @@ void overmap::move_hordes()
                 mg.abs_pos.y()++;
             }
 
-            // Erase the group at it's old location, add the group with the new location
-            tmpzg.emplace( mg.rel_pos(), mg );
-            zg.erase( it++ );
+            // Take the group out of its old location, it's put back at the new location below
+            decltype( zg )::node_type node = zg.extract( it++ );
+            node.key() = node.mapped().rel_pos();
+            moved.push_back( std::move( node ) );
         } else {
             ++it;
         }
     }
     // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
+    for( decltype( zg )::node_type &node : moved ) {
+        zg.insert( std::move( node ) );
+    }
 
     if( get_option<bool>( "WANDER_SPAWNS" ) ) {
+        // Whether monsters on a terrain are out in the open, looked up once per terrain type
+        std::unordered_map<oter_id, bool> open_terrain;
+        const auto is_open_terrain = [&]( const oter_id & ter ) {
+            const auto it = open_terrain.find( ter );
+            if( it != open_terrain.end() ) {
+                return it->second;
+            }
+            const bool open = is_ot_match( "field", ter, ot_match_type::contains ) ||
+                              is_ot_match( "road", ter, ot_match_type::contains ) ||
+                              is_ot_match( "forest", ter, ot_match_type::prefix ) ||
+                              is_ot_match( "swamp", ter, ot_match_type::prefix );
+            open_terrain.emplace( ter, open );
+            return open;
+        };
 
         // Re-absorb zombies into hordes.
         // Scan over monsters outside the player's view and place them back into hordes.
@@ -3995,16 +4015,9 @@ void overmap::move_hordes()
             }
 
             // Only monsters in the open (fields, forests, roads) are eligible to wander
-            const oter_id &om_here = ter( project_to<coords::omt>( p ) );
-            if( !is_ot_match( "field", om_here, ot_match_type::contains ) ) {
-                if( !is_ot_match( "road", om_here, ot_match_type::contains ) ) {
-                    if( !is_ot_match( "forest", om_here, ot_match_type::prefix ) ) {
-                        if( !is_ot_match( "swamp", om_here, ot_match_type::prefix ) ) {
-                            monster_map_it++;
-                            continue;
-                        }
-                    }
-                }
+            if( !is_open_terrain( ter( project_to<coords::omt>( p ) ) ) ) {
+                monster_map_it++;
+                continue;
             }
 
             // Scan for compatible hordes in this area, selecting the largest.
@@ -4051,7 +4064,7 @@ void overmap::move_hordes()
 void overmap::move_nemesis()
 {
     // Prevent hordes to be moved twice by putting them in here after moving.
-    decltype( zg ) tmpzg;
+    std::vector<decltype( zg )::node_type> moved;
     //cycle through zombie groups, skip non-nemesis hordes
     for( std::multimap<tripoint_om_sm, mongroup>::iterator it = zg.begin(); it != zg.end(); ) {
         mongroup &mg = it->second;
@@ -4099,9 +4112,10 @@ void overmap::move_nemesis()
             //update the horde's om_sm coords from the abs_sm so it can spawn in correctly
             if( project_to<coords::om>( mg.nemesis_target ) == omp ) {
 
-                // Erase the group at its old location, add the group with the new location
-                tmpzg.emplace( mg.rel_pos(), mg );
-                zg.erase( it++ );
+                // Take the group out of its old location, it's put back at the new location below
+                decltype( zg )::node_type node = zg.extract( it++ );
+                node.key() = node.mapped().rel_pos();
+                moved.push_back( std::move( node ) );
 
                 //there is only one nemesis horde, so we can stop looping after we move it
                 break;
@@ -4117,7 +4131,9 @@ void overmap::move_nemesis()
         }
     }
     // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
+    for( decltype( zg )::node_type &node : moved ) {
+        zg.insert( std::move( node ) );
+    }
 
 }
 
@@ -6520,14 +6536,16 @@ void overmap::open( overmap_special_batch &enabled_specials )
     }
 }
 
-// Note: this may throw io errors from std::ofstream
+// Note: the files are written in the background, write errors are reported by save_writer::wait
 void overmap::save() const
 {
-    write_to_file( overmapbuffer::player_filename( loc ), [&]( std::ostream & stream ) {
+    save_writer::write_to_file( overmapbuffer::player_filename( loc ), [&](
+    std::ostream & stream ) {
         serialize_view( stream );
     } );
 
-    write_to_file( overmapbuffer::terrain_filename( loc ), [&]( std::ostream & stream ) {
+    save_writer::write_to_file( overmapbuffer::terrain_filename( loc ), [&](
+    std::ostream & stream ) {
         serialize( stream );
     } );
 }
@@ -8,7 +8,6 @@
 #include <cmath>
 #include <cstdlib>
 #include <functional>
-#include <iterator>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -164,9 +163,35 @@ class pixel_minimap::shared_texture_pool
         std::vector<size_t> inactive_index;
 };
 
+//what the color of a tile is computed from, apart from the details of vehicles
+struct minimap_tile_state {
+    ter_id ter;
+    furn_id furn;
+    lit_level lighting = lit_level::BLANK;
+    bool vehicle = false;
+
+    bool operator==( const minimap_tile_state &rhs ) const {
+        return ter == rhs.ter && furn == rhs.furn && lighting == rhs.lighting &&
+               vehicle == rhs.vehicle;
+    }
+    bool operator!=( const minimap_tile_state &rhs ) const {
+        return !( *this == rhs );
+    }
+};
+
+//the number of chunks per row and column of the cache ring buffer
+constexpr int cache_ring_size = MAPSIZE + 1;
+
 struct pixel_minimap::submap_cache {
+    //the absolute submap position this chunk currently shows
+    tripoint abs_sm_pos;
+    //whether the chunk shows anything, otherwise it is free for reuse
+    bool in_use = false;
     //the color stored for each submap tile
     std::array<SDL_Color, SEEX *SEEY> minimap_colors = {};
+    //the state each color was computed from, only valid if states_valid
+    std::array<minimap_tile_state, SEEX *SEEY> tile_states = {};
+    bool states_valid = false;
     //checks if the submap has been looked at by the minimap routine
     bool touched = false;
     //the texture updates are drawn to
@@ -200,6 +225,21 @@ struct pixel_minimap::submap_cache {
 
         return minimap_colors[p.y * SEEX + p.x];
     }
+
+    minimap_tile_state &state_at( const point &p ) {
+        return tile_states[p.y * SEEX + p.x];
+    }
+
+    //starts over showing another submap, keeping the texture
+    void reuse( const tripoint &pos ) {
+        abs_sm_pos = pos;
+        in_use = true;
+        minimap_colors = {};
+        states_valid = false;
+        touched = false;
+        update_list.clear();
+        ready = false;
+    }
 };
 
 pixel_minimap::pixel_minimap( const SDL_Renderer_Ptr &renderer,
@@ -234,25 +274,27 @@ void pixel_minimap::prepare_cache_for_updates( const tripoint &center )
     const tripoint center_sm_diff = cached_center_sm - new_center_sm;
 
     //invalidate the cache if the game shifted more than one submap in the last update, or if z-level changed.
-    if( std::abs( center_sm_diff.x ) > 1 ||
-        std::abs( center_sm_diff.y ) > 1 ||
-        std::abs( center_sm_diff.z ) > 0 ) {
-        cache.clear();
-    } else {
-        for( auto &mcp : cache ) {
-            mcp.second.touched = false;
+    const bool invalidate = std::abs( center_sm_diff.x ) > 1 ||
+                            std::abs( center_sm_diff.y ) > 1 ||
+                            std::abs( center_sm_diff.z ) > 0;
+    for( submap_cache &chunk : cache ) {
+        if( invalidate ) {
+            chunk.in_use = false;
         }
+        chunk.touched = false;
     }
 
     cached_center_sm = new_center_sm;
 }
 
-//deletes the mapping of unused submap caches from the main map
-//the touched flag prevents deletion
+//frees the chunks of submaps that are no longer shown
+//the touched flag prevents it
 void pixel_minimap::clear_unused_cache()
 {
-    for( auto it = cache.begin(); it != cache.end(); ) {
-        it = it->second.touched ? std::next( it ) : cache.erase( it );
+    for( submap_cache &chunk : cache ) {
+        if( !chunk.touched ) {
+            chunk.in_use = false;
+        }
     }
 }
 
@@ -260,15 +302,15 @@ void pixel_minimap::clear_unused_cache()
 //the render target will be set back to display_buffer after all submaps are updated
 void pixel_minimap::flush_cache_updates()
 {
-    for( auto &mcp : cache ) {
-        if( mcp.second.update_list.empty() ) {
+    for( submap_cache &chunk : cache ) {
+        if( !chunk.in_use || chunk.update_list.empty() ) {
             continue;
         }
 
-        SetRenderTarget( renderer, mcp.second.chunk_tex );
+        SetRenderTarget( renderer, chunk.chunk_tex );
 
-        if( !mcp.second.ready ) {
-            mcp.second.ready = true;
+        if( !chunk.ready ) {
+            chunk.ready = true;
 
             SetRenderDrawColor( renderer, 0x00, 0x00, 0x00, 0x00 );
             RenderClear( renderer );
@@ -285,9 +327,9 @@ void pixel_minimap::flush_cache_updates()
             }
         }
 
-        for( const point &p : mcp.second.update_list ) {
+        for( const point &p : chunk.update_list ) {
             const point tile_pos = projector->get_tile_pos( p, { SEEX, SEEY } );
-            const SDL_Color tile_color = mcp.second.color_at( p );
+            const SDL_Color tile_color = chunk.color_at( p );
 
             if( pixel_size.x == 1 && pixel_size.y == 1 ) {
                 SetRenderDrawColor( renderer, tile_color.r, tile_color.g, tile_color.b, tile_color.a );
@@ -297,7 +339,7 @@ void pixel_minimap::flush_cache_updates()
             }
         }
 
-        mcp.second.update_list.clear();
+        chunk.update_list.clear();
     }
 }
 
@@ -312,12 +354,27 @@ void pixel_minimap::update_cache_at( const tripoint &sm_pos )
     const tripoint ms_pos = sm_to_ms_copy( sm_pos );
 
     cache_item.touched = true;
+    // Colors only need to be recomputed where the terrain, furniture or lighting changed,
+    // and where vehicles are, as their parts can change without the tile state noticing.
+    const bool recompute_all = !cache_item.states_valid || nv_goggle != cached_nv_goggle;
+    cache_item.states_valid = true;
 
     for( int y = 0; y < SEEY; ++y ) {
         for( int x = 0; x < SEEX; ++x ) {
             const tripoint p = ms_pos + tripoint{ x, y, 0 };
             const lit_level lighting = access_cache.visibility_cache[p.x][p.y];
 
+            minimap_tile_state state;
+            state.ter = here.ter( p );
+            state.furn = here.furn( p );
+            state.lighting = lighting;
+            state.vehicle = access_cache.get_veh_exists_at( p );
+            minimap_tile_state &old_state = cache_item.state_at( { x, y } );
+            if( !recompute_all && !state.vehicle && state == old_state ) {
+                continue;
+            }
+            old_state = state;
+
             SDL_Color color;
 
             if( lighting == lit_level::BLANK || lighting == lit_level::DARK ) {
@@ -350,15 +407,19 @@ void pixel_minimap::update_cache_at( const tripoint &sm_pos )
     }
 }
 
+//the chunks shown at once span less than cache_ring_size submaps in each direction,
+//so they never share a slot
 pixel_minimap::submap_cache &pixel_minimap::get_cache_at( const tripoint &abs_sm_pos )
 {
-    auto it = cache.find( abs_sm_pos );
+    const int x = ( abs_sm_pos.x % cache_ring_size + cache_ring_size ) % cache_ring_size;
+    const int y = ( abs_sm_pos.y % cache_ring_size + cache_ring_size ) % cache_ring_size;
+    submap_cache &chunk = cache[y * cache_ring_size + x];
 
-    if( it == cache.end() ) {
-        it = cache.emplace( abs_sm_pos, submap_cache( *tex_pool ) ).first;
+    if( !chunk.in_use || chunk.abs_sm_pos != abs_sm_pos ) {
+        chunk.reuse( abs_sm_pos );
     }
 
-    return it->second;
+    return chunk;
 }
 
 void pixel_minimap::process_cache( const tripoint &center )
@@ -370,6 +431,7 @@ void pixel_minimap::process_cache( const tripoint &center )
             update_cache_at( { x, y, center.z } );
         }
     }
+    cached_nv_goggle = get_player_character().get_vision_modes()[NV_GOGGLES];
 
     flush_cache_updates();
     clear_unused_cache();
@@ -427,6 +489,12 @@ void pixel_minimap::set_screen_rect( const SDL_Rect &screen_rect )
     };
 
     tex_pool = std::make_unique<shared_texture_pool>( chunk_texture_generator );
+
+    //the pool holds exactly one texture per slot
+    cache.reserve( cache_ring_size * cache_ring_size );
+    for( int i = 0; i < cache_ring_size * cache_ring_size; ++i ) {
+        cache.emplace_back( *tex_pool );
+    }
 }
 
 void pixel_minimap::reset()
@@ -467,12 +535,12 @@ void pixel_minimap::render_cache( const tripoint &center )
                                   ( total_tiles_count.y / 2 ) % SEEY );
     ms_offset = ms_base_offset - ms_offset;
 
-    for( const auto &elem : cache ) {
-        if( !elem.second.touched ) {
+    for( const submap_cache &elem : cache ) {
+        if( !elem.in_use || !elem.touched ) {
             continue;   // What you gonna do with all that junk?
         }
 
-        const tripoint rel_pos = elem.first - sm_center;
+        const tripoint rel_pos = elem.abs_sm_pos - sm_center;
 
         if( std::abs( rel_pos.x ) > sm_offset.x + 1 ||
             std::abs( rel_pos.y ) > sm_offset.y + 1 ||
@@ -485,7 +553,7 @@ void pixel_minimap::render_cache( const tripoint &center )
 
         const SDL_Rect chunk_rect = projector->get_chunk_rect( ms_pos.xy(), { SEEX, SEEY } );
 
-        RenderCopy( renderer, elem.second.chunk_tex, nullptr, &chunk_rect );
+        RenderCopy( renderer, elem.chunk_tex, nullptr, &chunk_rect );
     }
 }
 
@@ -2,8 +2,8 @@
 #ifndef CATA_SRC_PIXEL_MINIMAP_H
 #define CATA_SRC_PIXEL_MINIMAP_H
 
-#include <map>
 #include <memory>
+#include <vector>
 
 #include "point.h"
 #include "sdl_wrappers.h"
@@ -75,6 +75,8 @@ class pixel_minimap
 
         //track the previous viewing area to determine if the minimap cache needs to be cleared
         tripoint cached_center_sm;
+        //night vision changes the color of every tile
+        bool cached_nv_goggle = false;
 
         SDL_Rect screen_rect;
         SDL_Rect main_tex_clip_rect;
@@ -88,7 +90,8 @@ class pixel_minimap
         class shared_texture_pool;
         std::unique_ptr<shared_texture_pool> tex_pool;
 
-        std::map<tripoint, submap_cache> cache;
+        //one chunk per slot of a ring buffer indexed by submap coordinates, see get_cache_at
+        std::vector<submap_cache> cache;
 };
 
 #endif // CATA_SRC_PIXEL_MINIMAP_H
@@ -26,6 +26,7 @@ class Character;
 class JsonObject;
 class JsonOut;
 class avatar;
+class loot_zone_index;
 class monster;
 class translation;
 
@@ -80,6 +81,8 @@ class player_activity
          *  Initially assume there is a fire unless the activity proves not to have one.
          */
         bool have_fire = true; // NOLINT(cata-serialize)
+        /** Zones around a loot sorter, rebuilt after loading. Only used by ACT_MOVE_LOOT. */
+        shared_ptr_fast<const loot_zone_index> loot_zones; // NOLINT(cata-serialize)
 
         player_activity();
         // This constructor does not work with activities using the new activity_actor system
@@ -4,6 +4,7 @@
 #include <iterator>
 #include <memory>
 #include <new>
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -23,6 +24,7 @@
 #include "requirements.h"
 #include "skill.h"
 #include "translations.h"
+#include "trigram_index.h"
 #include "uistate.h"
 #include "units.h"
 #include "value_ptr.h"
@@ -110,6 +112,79 @@ bool search_reqs( const std::vector<std::vector<item_comp> > &gp,
     } );
 }
 
+namespace
+{
+
+/**
+ * Trigram indices over the translated texts of all recipes, see @ref trigram_index.
+ * Built on the first search and rebuilt when the language changes.
+ */
+struct recipe_search_index {
+    int language_version = INVALID_LANGUAGE_VERSION;
+    // All indexed recipes, sorted by address, the document id is the position in here.
+    std::vector<const recipe *> docs;
+    trigram_index names;
+    trigram_index components;
+    // Only practice recipes, others are searched by the info of their result.
+    trigram_index descriptions;
+
+    void build();
+    bool contains( const recipe *r ) const {
+        return std::binary_search( docs.begin(), docs.end(), r, std::less<>() );
+    }
+    // Recipes (sorted by address) that may match qry, or nullopt if every recipe may.
+    std::optional<std::vector<const recipe *>> candidates( const trigram_index &index,
+                                            std::string_view qry ) const;
+};
+
+recipe_search_index recipe_index;
+
+} // namespace
+
+void recipe_search_index::build()
+{
+    docs.clear();
+    names.clear();
+    components.clear();
+    descriptions.clear();
+    for( const auto &e : recipe_dict ) {
+        docs.push_back( &e.second );
+    }
+    std::sort( docs.begin(), docs.end(), std::less<>() );
+    for( size_t i = 0; i < docs.size(); i++ ) {
+        const recipe &r = *docs[i];
+        const trigram_index::doc_id doc = static_cast<trigram_index::doc_id>( i );
+        names.add( doc, r.result_name() );
+        for( const std::vector<item_comp> &opts : r.simple_requirements().get_components() ) {
+            for( const item_comp &ic : opts ) {
+                components.add( doc, item::nname( ic.type ) );
+            }
+        }
+        if( r.is_practice() ) {
+            descriptions.add( doc, r.description.translated() );
+        }
+    }
+    names.finalize();
+    components.finalize();
+    descriptions.finalize();
+    language_version = detail::get_current_language_version();
+}
+
+std::optional<std::vector<const recipe *>> recipe_search_index::candidates(
+        const trigram_index &index, const std::string_view qry ) const
+{
+    std::optional<std::vector<trigram_index::doc_id>> ids = index.candidates( qry );
+    if( !ids ) {
+        return std::nullopt;
+    }
+    std::vector<const recipe *> res;
+    res.reserve( ids->size() );
+    for( const trigram_index::doc_id id : *ids ) {
+        res.push_back( docs[id] );
+    }
+    return res;
+}
+
 std::vector<const recipe *> recipe_subset::favorite() const
 {
     std::vector<const recipe *> res;
@@ -171,10 +246,44 @@ std::vector<const recipe *> recipe_subset::search(
     const std::string_view txt, const search_type key,
     const std::function<void( size_t, size_t )> &progress_callback ) const
 {
+    const trigram_index *index = nullptr;
+    switch( key ) {
+        case search_type::name:
+        case search_type::exclude_name:
+            index = &recipe_index.names;
+            break;
+        case search_type::component:
+            index = &recipe_index.components;
+            break;
+        case search_type::description_result:
+            index = &recipe_index.descriptions;
+            break;
+        default:
+            break;
+    }
+    std::optional<std::vector<const recipe *>> candidates;
+    if( index ) {
+        if( recipe_index.language_version != detail::get_current_language_version() ) {
+            recipe_index.build();
+        }
+        candidates = recipe_index.candidates( *index, txt );
+    }
+    // Whether the indexed texts of r certainly do not contain txt.
+    auto ruled_out = [&]( const recipe * r ) {
+        if( !candidates || ( key == search_type::description_result && !r->is_practice() ) ) {
+            return false;
+        }
+        return !std::binary_search( candidates->begin(), candidates->end(), r, std::less<>() ) &&
+               recipe_index.contains( r );
+    };
+
     auto predicate = [&]( const recipe * r ) {
         if( !*r || r->obsolete ) {
             return false;
         }
+        if( ruled_out( r ) ) {
+            return key == search_type::exclude_name;
+        }
         switch( key ) {
             case search_type::name:
                 return lcmatch( r->result_name(), txt );
@@ -679,6 +788,7 @@ void recipe_dictionary::check_consistency()
 
 void recipe_dictionary::reset()
 {
+    recipe_index = recipe_search_index();
     recipe_dict.blueprints.clear();
     recipe_dict.autolearn.clear();
     recipe_dict.nested.clear();
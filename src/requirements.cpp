@@ -905,6 +905,56 @@ bool requirement_data::has_comps( const read_only_visitable &crafting_inv,
     return retval;
 }
 
+static requirement_check_cache *active_check_cache = nullptr;
+
+requirement_check_cache::requirement_check_cache( const read_only_visitable &inv )
+    : inv( inv ), previous( active_check_cache )
+{
+    active_check_cache = this;
+}
+
+requirement_check_cache::~requirement_check_cache()
+{
+    active_check_cache = previous;
+}
+
+requirement_check_cache *requirement_check_cache::get( const read_only_visitable &inv )
+{
+    if( active_check_cache != nullptr && &active_check_cache->inv == &inv ) {
+        return active_check_cache;
+    }
+    return nullptr;
+}
+
+bool requirement_check_cache::has_quality( const quality_id &type, const int level,
+        const int count )
+{
+    const auto key = std::make_tuple( type, level, count );
+    const auto it = qualities.find( key );
+    if( it != qualities.end() ) {
+        return it->second;
+    }
+    return qualities[key] = inv.has_quality( type, level, count );
+}
+
+bool requirement_check_cache::has_tools( const itype_id &type, const int count )
+{
+    const auto key = std::make_pair( type, count );
+    const auto it = tools.find( key );
+    if( it != tools.end() ) {
+        return it->second;
+    }
+    return tools[key] = inv.has_tools( type, count, return_true<item> );
+}
+
+// Whether filter is the return_true<item> requirement checks pass for tools
+static bool is_unfiltered( const std::function<bool( const item & )> &filter )
+{
+    using filter_fn = bool ( * )( const item & );
+    const filter_fn *fn = filter.target<filter_fn>();
+    return fn != nullptr && *fn == &return_true<item>;
+}
+
 bool quality_requirement::has(
     const read_only_visitable &crafting_inv, const std::function<bool( const item & )> &, int,
     craft_flags, const std::function<void( int )> & ) const
@@ -912,6 +962,9 @@ bool quality_requirement::has(
     if( get_player_character().has_trait( trait_DEBUG_HS ) ) {
         return true;
     }
+    if( requirement_check_cache *cache = requirement_check_cache::get( crafting_inv ) ) {
+        return cache->has_quality( type, level, count );
+    }
     return crafting_inv.has_quality( type, level, count );
 }
 
@@ -934,6 +987,10 @@ bool tool_comp::has(
         return true;
     }
     if( !by_charges() ) {
+        requirement_check_cache *cache = requirement_check_cache::get( crafting_inv );
+        if( cache != nullptr && is_unfiltered( filter ) ) {
+            return cache->has_tools( type, std::abs( count ) );
+        }
         return crafting_inv.has_tools( type, std::abs( count ), filter );
     } else {
         int charges_required = count * batch * item::find_type( type )->charge_factor();
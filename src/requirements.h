@@ -167,6 +167,31 @@ struct quality_requirement {
     }
 };
 
+/**
+ * While it exists, remembers which qualities and which tools (not counted by charges) an
+ * inventory has, so the many requirements asking for the same ones share a single check.
+ * The inventory must not change meanwhile. The innermost cache is the active one.
+ */
+class requirement_check_cache
+{
+    public:
+        explicit requirement_check_cache( const read_only_visitable &inv );
+        ~requirement_check_cache();
+        requirement_check_cache( const requirement_check_cache & ) = delete;
+        requirement_check_cache &operator=( const requirement_check_cache & ) = delete;
+
+        /** The active cache if it is for inv. */
+        static requirement_check_cache *get( const read_only_visitable &inv );
+
+        bool has_quality( const quality_id &type, int level, int count );
+        bool has_tools( const itype_id &type, int count );
+    private:
+        const read_only_visitable &inv;
+        requirement_check_cache *previous;
+        std::map<std::tuple<quality_id, int, int>, bool> qualities;
+        std::map<std::pair<itype_id, int>, bool> tools;
+};
+
 enum class requirement_display_flags : int {
     none = 0,
     no_unavailable = 1,
@@ -0,0 +1,275 @@
+#include "save_writer.h"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32) || defined(_MSC_VER)
+#   define SAVE_WRITER_THREADS
+#   include <condition_variable>
+#   include <mutex>
+#   include <thread>
+#endif
+
+#include "cached_options.h"
+#include "cata_path.h"
+#include "debug.h"
+#include "ofstream_wrapper.h"
+#include "output.h"
+#include "string_formatter.h"
+#include "translations.h"
+
+namespace
+{
+
+struct write_job {
+    fs::path path;
+    std::string contents;
+};
+
+struct write_error {
+    fs::path path;
+    std::string what;
+};
+
+std::optional<write_error> write_contents( const write_job &job )
+{
+    try {
+        ofstream_wrapper fout( job.path, std::ios::binary );
+        fout.stream().write( job.contents.data(), job.contents.size() );
+        fout.close();
+    } catch( const std::exception &err ) {
+        return write_error{ job.path, err.what() };
+    }
+    return std::nullopt;
+}
+
+#if defined(SAVE_WRITER_THREADS)
+
+class writer_pool
+{
+    public:
+        ~writer_pool() {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                stopping = true;
+            }
+            work_available.notify_all();
+            for( std::thread &t : threads ) {
+                t.join();
+            }
+        }
+
+        void push( const fs::path &path, std::string contents ) {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                const auto it = queued.find( path );
+                if( it != queued.end() ) {
+                    it->second->contents = std::move( contents );
+                    return;
+                }
+                queue.push_back( write_job{ path, std::move( contents ) } );
+                queued.emplace( path, std::prev( queue.end() ) );
+                if( threads.empty() ) {
+                    // Writing is mostly waiting for the disk, a few threads keep it busy.
+                    const unsigned int num_threads =
+                        std::clamp( std::thread::hardware_concurrency(), 2u, 4u );
+                    for( unsigned int i = 0; i < num_threads; i++ ) {
+                        threads.emplace_back( &writer_pool::run, this );
+                    }
+                }
+            }
+            work_available.notify_all();
+        }
+
+        void flush() {
+            std::unique_lock<std::mutex> lock( mutex );
+            all_done.wait( lock, [this]() {
+                return queue.empty() && in_progress.empty();
+            } );
+        }
+
+        std::vector<write_error> take_errors() {
+            std::lock_guard<std::mutex> lock( mutex );
+            return std::exchange( errors, {} );
+        }
+
+    private:
+        /// The first queued job whose file is not being written by another thread right now.
+        std::list<write_job>::iterator next_job() {
+            return std::find_if( queue.begin(), queue.end(), [this]( const write_job & job ) {
+                return in_progress.count( job.path ) == 0;
+            } );
+        }
+
+        void run() {
+            std::unique_lock<std::mutex> lock( mutex );
+            while( true ) {
+                auto it = queue.end();
+                work_available.wait( lock, [&]() {
+                    it = next_job();
+                    return it != queue.end() || ( stopping && queue.empty() );
+                } );
+                if( it == queue.end() ) {
+                    return;
+                }
+                write_job job = std::move( *it );
+                queued.erase( job.path );
+                queue.erase( it );
+                in_progress.insert( job.path );
+
+                lock.unlock();
+                std::optional<write_error> err = write_contents( job );
+                lock.lock();
+
+                in_progress.erase( job.path );
+                if( err ) {
+                    errors.emplace_back( std::move( *err ) );
+                }
+                // Jobs for the same path may have been waiting for this one
+                work_available.notify_all();
+                if( queue.empty() && in_progress.empty() ) {
+                    all_done.notify_all();
+                }
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable work_available;
+        std::condition_variable all_done;
+        std::list<write_job> queue;
+        /// Jobs in @ref queue by path.
+        std::map<fs::path, std::list<write_job>::iterator> queued;
+        std::set<fs::path> in_progress;
+        std::vector<write_error> errors;
+        std::vector<std::thread> threads;
+        bool stopping = false;
+};
+
+#else
+
+// Without thread support, files are written right away.
+class writer_pool
+{
+    public:
+        void push( const fs::path &path, std::string contents ) {
+            std::optional<write_error> err =
+                write_contents( write_job{ path, std::move( contents ) } );
+            if( err ) {
+                errors.emplace_back( std::move( *err ) );
+            }
+        }
+
+        void flush() {}
+
+        std::vector<write_error> take_errors() {
+            return std::exchange( errors, {} );
+        }
+
+    private:
+        std::vector<write_error> errors;
+};
+
+#endif
+
+writer_pool &get_pool()
+{
+    static writer_pool pool;
+    return pool;
+}
+
+std::string serialize( const std::function<void( std::ostream & )> &writer )
+{
+    std::ostringstream buffer;
+    writer( buffer );
+    if( buffer.fail() ) {
+        throw std::runtime_error( "writing to file failed" );
+    }
+    return buffer.str();
+}
+
+void report( const std::string &msg )
+{
+    if( test_mode ) {
+        DebugLog( D_ERROR, DC_ALL ) << msg;
+    } else {
+        popup( "%s", msg );
+    }
+}
+
+} // namespace
+
+namespace save_writer
+{
+
+void write( const fs::path &path, std::string contents )
+{
+    get_pool().push( path, std::move( contents ) );
+}
+
+void write_to_file( const cata_path &path, const std::function<void( std::ostream & )> &writer )
+{
+    write( path.get_unrelative_path(), serialize( writer ) );
+}
+
+void write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer )
+{
+    write( fs::u8path( path ), serialize( writer ) );
+}
+
+bool write_to_file( const cata_path &path, const std::function<void( std::ostream & )> &writer,
+                    const char *const fail_message )
+{
+    try {
+        save_writer::write_to_file( path, writer );
+        return true;
+    } catch( const std::exception &err ) {
+        if( fail_message ) {
+            report( string_format( _( "Failed to write %1$s to \"%2$s\": %3$s" ),
+                                   fail_message, path.generic_u8string(), err.what() ) );
+        }
+        return false;
+    }
+}
+
+bool write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer,
+                    const char *const fail_message )
+{
+    try {
+        save_writer::write_to_file( path, writer );
+        return true;
+    } catch( const std::exception &err ) {
+        if( fail_message ) {
+            report( string_format( _( "Failed to write %1$s to \"%2$s\": %3$s" ),
+                                   fail_message, path, err.what() ) );
+        }
+        return false;
+    }
+}
+
+void flush()
+{
+    get_pool().flush();
+}
+
+bool wait()
+{
+    get_pool().flush();
+    const std::vector<write_error> errors = get_pool().take_errors();
+    for( const write_error &err : errors ) {
+        report( string_format( _( "Failed to write \"%1$s\": %2$s" ),
+                               err.path.generic_u8string(), err.what ) );
+    }
+    return errors.empty();
+}
+
+} // namespace save_writer
@@ -0,0 +1,59 @@
+#pragma once
+#ifndef CATA_SRC_SAVE_WRITER_H
+#define CATA_SRC_SAVE_WRITER_H
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+
+#include "filesystem.h"
+
+class cata_path;
+
+/**
+ * Writes save files on background threads.
+ *
+ * The contents are serialized on the calling thread (the game state is not thread safe), only
+ * writing them to disk happens in the background. Like @ref write_to_file, each file is written
+ * to a temporary file first, which is then renamed over the target.
+ *
+ * A queued file is not on disk until it has been written. Code that reads save files through
+ * @ref read_from_file and friends waits for them automatically, anything else that reads or
+ * removes save files has to call @ref flush first.
+ */
+namespace save_writer
+{
+
+/**
+ * Serializes the data with writer right away and queues it to be written to path.
+ * A file that is still queued for the same path is replaced.
+ * @throws Whatever writer throws. Write errors are reported by @ref wait instead.
+ */
+void write_to_file( const cata_path &path, const std::function<void( std::ostream & )> &writer );
+void write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer );
+/**
+ * Same as above, but catches exceptions of writer. Those are reported to the user like
+ * @ref ::write_to_file does.
+ * @returns Whether the data could be serialized.
+ */
+bool write_to_file( const cata_path &path, const std::function<void( std::ostream & )> &writer,
+                    const char *fail_message );
+bool write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer,
+                    const char *fail_message );
+
+/** Queues contents to be written to path. */
+void write( const fs::path &path, std::string contents );
+
+/** Blocks until all queued files are written. */
+void flush();
+
+/**
+ * Blocks until all queued files are written, and reports the files that failed to be written
+ * since the last call to the user.
+ * @returns Whether all of them were written.
+ */
+bool wait();
+
+} // namespace save_writer
+
+#endif // CATA_SRC_SAVE_WRITER_H
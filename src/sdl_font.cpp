@@ -280,12 +280,11 @@ CachedTTFFont::CachedTTFFont(
     TTF_SetFontStyle( font.get(), TTF_STYLE_NORMAL );
 }
 
-SDL_Texture_Ptr CachedTTFFont::create_glyph( const SDL_Renderer_Ptr &renderer,
-        const std::string &ch,
-        const int color )
+SDL_Surface_Ptr CachedTTFFont::create_glyph( const std::string &ch )
 {
+    constexpr SDL_Color white{255, 255, 255, 255};
     const auto function = fontblending ? TTF_RenderUTF8_Blended : TTF_RenderUTF8_Solid;
-    SDL_Surface_Ptr sglyph( function( font.get(), ch.c_str(), windowsPalette[color] ) );
+    SDL_Surface_Ptr sglyph( function( font.get(), ch.c_str(), white ) );
     if( !sglyph ) {
         dbg( D_ERROR ) << "Failed to create glyph for " << ch << ": " << TTF_GetError();
         return nullptr;
@@ -325,12 +324,69 @@ SDL_Texture_Ptr CachedTTFFont::create_glyph( const SDL_Renderer_Ptr &renderer,
         src_rect.h = dst_rect.h;
     }
 
-    if( !printErrorIf( SDL_BlitSurface( sglyph.get(), &src_rect, surface.get(), &dst_rect ) != 0,
-                       "SDL_BlitSurface failed" ) ) {
-        sglyph = std::move( surface );
+    // The surface has the layout of SDL_PIXELFORMAT_RGBA32, so it can be copied into the atlas
+    if( printErrorIf( SDL_BlitSurface( sglyph.get(), &src_rect, surface.get(), &dst_rect ) != 0,
+                      "SDL_BlitSurface failed" ) ) {
+        return nullptr;
     }
+    return surface;
+}
 
-    return CreateTextureFromSurface( renderer, sglyph );
+CachedTTFFont::atlas_glyph CachedTTFFont::add_to_atlas( const SDL_Renderer_Ptr &renderer,
+        const SDL_Surface_Ptr &glyph, const int cells )
+{
+    atlas_glyph result;
+    if( !glyph ) {
+        return result;
+    }
+    if( atlas_cursor.x + cells > atlas_cells ) {
+        atlas_cursor = point( 0, atlas_cursor.y + 1 );
+    }
+    if( atlas_pages.empty() || atlas_cursor.y >= atlas_cells ) {
+        SDL_Texture_Ptr page = CreateTexture( renderer, SDL_PIXELFORMAT_RGBA32,
+                                              SDL_TEXTUREACCESS_STATIC,
+                                              width * atlas_cells, height * atlas_cells );
+        if( !page ) {
+            return result;
+        }
+        SetTextureBlendMode( page, SDL_BLENDMODE_BLEND );
+        atlas_pages.emplace_back( std::move( page ) );
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        queued_vertices.resize( atlas_pages.size() );
+#endif
+        atlas_cursor = point_zero;
+    }
+    const SDL_Rect rect{ atlas_cursor.x * width, atlas_cursor.y * height, glyph->w, glyph->h };
+    if( printErrorIf( SDL_UpdateTexture( atlas_pages.back().get(), &rect, glyph->pixels,
+                                         glyph->pitch ) != 0, "SDL_UpdateTexture failed" ) ) {
+        return result;
+    }
+    atlas_cursor.x += cells;
+    result.page = static_cast<int>( atlas_pages.size() ) - 1;
+    result.rect = rect;
+    return result;
+}
+
+const CachedTTFFont::atlas_glyph &CachedTTFFont::get_glyph( const SDL_Renderer_Ptr &renderer,
+        const std::string &ch )
+{
+    const char *src = ch.c_str();
+    int len = ch.length();
+    const uint32_t cp = UTF8_getch( &src, &len );
+    if( len == 0 ) {
+        const auto it = glyphs.find( cp );
+        if( it != glyphs.end() ) {
+            return it->second;
+        }
+        return glyphs.emplace( cp, add_to_atlas( renderer, create_glyph( ch ),
+                               utf8_width( ch ) ) ).first->second;
+    }
+    const auto it = cluster_glyphs.find( ch );
+    if( it != cluster_glyphs.end() ) {
+        return it->second;
+    }
+    return cluster_glyphs.emplace( ch, add_to_atlas( renderer, create_glyph( ch ),
+                                   utf8_width( ch ) ) ).first->second;
 }
 
 bool CachedTTFFont::isGlyphProvided( const std::string &ch ) const
@@ -350,30 +406,66 @@ void CachedTTFFont::OutputChar( const SDL_Renderer_Ptr &renderer, const Geometry
                                 const std::string &ch, const point &p,
                                 unsigned char color, const float opacity )
 {
-    key_t    key {ch, static_cast<unsigned char>( color & 0xf )};
-
-    auto it = glyph_cache_map.find( key );
-    if( it == std::end( glyph_cache_map ) ) {
-        cached_t new_entry {
-            create_glyph( renderer, key.codepoints, key.color ),
-            static_cast<int>( width * utf8_width( key.codepoints ) )
-        };
-        it = glyph_cache_map.insert( std::make_pair( std::move( key ), std::move( new_entry ) ) ).first;
-    }
-    const cached_t &value = it->second;
-
-    if( !value.texture ) {
+    const atlas_glyph &glyph = get_glyph( renderer, ch );
+    if( glyph.page < 0 ) {
         // Nothing we can do here )-:
         return;
     }
-    SDL_Rect rect {p.x, p.y, value.width, height};
-    if( opacity != 1.0f ) {
-        SDL_SetTextureAlphaMod( value.texture.get(), opacity * 255.0f );
+    const SDL_Color &fg = windowsPalette[color & 0xf];
+    const Uint8 alpha = opacity * 255.0f;
+    const SDL_Rect rect{ p.x, p.y, glyph.rect.w, glyph.rect.h };
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if( batching ) {
+        const float page_w = width * atlas_cells;
+        const float page_h = height * atlas_cells;
+        const SDL_Color vertex_color{ fg.r, fg.g, fg.b, alpha };
+        const auto vertex = [&]( const int dx, const int dy ) {
+            SDL_Vertex v;
+            v.position.x = rect.x + dx * rect.w;
+            v.position.y = rect.y + dy * rect.h;
+            v.color = vertex_color;
+            v.tex_coord.x = ( glyph.rect.x + dx * glyph.rect.w ) / page_w;
+            v.tex_coord.y = ( glyph.rect.y + dy * glyph.rect.h ) / page_h;
+            return v;
+        };
+        std::vector<SDL_Vertex> &vertices = queued_vertices[glyph.page];
+        vertices.push_back( vertex( 0, 0 ) );
+        vertices.push_back( vertex( 1, 0 ) );
+        vertices.push_back( vertex( 0, 1 ) );
+        vertices.push_back( vertex( 0, 1 ) );
+        vertices.push_back( vertex( 1, 0 ) );
+        vertices.push_back( vertex( 1, 1 ) );
+        return;
     }
-    RenderCopy( renderer, value.texture, nullptr, &rect );
-    if( opacity != 1.0f ) {
-        SDL_SetTextureAlphaMod( value.texture.get(), 255 );
+#endif
+    const SDL_Texture_Ptr &page = atlas_pages[glyph.page];
+    SetTextureColorMod( page, fg.r, fg.g, fg.b );
+    SDL_SetTextureAlphaMod( page.get(), alpha );
+    RenderCopy( renderer, page, &glyph.rect, &rect );
+}
+
+void CachedTTFFont::begin_batch()
+{
+    batching = true;
+}
+
+void CachedTTFFont::end_batch( const SDL_Renderer_Ptr &renderer )
+{
+    batching = false;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    for( size_t i = 0; i < atlas_pages.size(); i++ ) {
+        std::vector<SDL_Vertex> &vertices = queued_vertices[i];
+        if( vertices.empty() ) {
+            continue;
+        }
+        printErrorIf( SDL_RenderGeometry( renderer.get(), atlas_pages[i].get(), vertices.data(),
+                                          vertices.size(), nullptr, 0 ) != 0,
+                      "SDL_RenderGeometry failed" );
+        vertices.clear();
     }
+#else
+    static_cast<void>( renderer );
+#endif
 }
 
 BitmapFont::BitmapFont(
@@ -613,4 +705,18 @@ void FontFallbackList::OutputChar( const SDL_Renderer_Ptr &renderer,
     ( *cached->second )->OutputChar( renderer, geometry, ch, p, color, opacity );
 }
 
+void FontFallbackList::begin_batch()
+{
+    for( std::unique_ptr<Font> &font : fonts ) {
+        font->begin_batch();
+    }
+}
+
+void FontFallbackList::end_batch( const SDL_Renderer_Ptr &renderer )
+{
+    for( std::unique_ptr<Font> &font : fonts ) {
+        font->end_batch( renderer );
+    }
+}
+
 #endif // TILES
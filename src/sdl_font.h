@@ -8,8 +8,10 @@
 #include "sdltiles.h" // IWYU pragma: associated
 
 #include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -18,7 +20,6 @@
 #include "color_loader.h"
 #include "debug.h"
 #include "point.h"
-#include "hash_utils.h"
 #include "sdl_wrappers.h"
 
 using palette_array = std::array<SDL_Color, color_loader<SDL_Color>::COLOR_NAMES_COUNT>;
@@ -43,6 +44,12 @@ class Font
                                  const std::string &ch, const point &p,
                                  unsigned char color, float opacity = 1.0f ) = 0;
 
+        /// Between these calls, fonts may queue the characters passed to @ref OutputChar and
+        /// draw all of them at once in @ref end_batch. Nothing else may be drawn over them in
+        /// between.
+        virtual void begin_batch() {}
+        virtual void end_batch( const SDL_Renderer_Ptr & ) {}
+
         /// Draw an ascii line using font's palette.
         /// @param line_id Character to draw
         /// @param point Point on the screen where to draw character
@@ -68,7 +75,7 @@ class Font
 };
 using Font_Ptr = std::unique_ptr<Font>;
 
-/// Font implementation on a TrueType font. Its glyphs are cached.
+/// Font implementation on a TrueType font. Its glyphs are cached in texture atlases.
 class CachedTTFFont : public Font
 {
     public:
@@ -83,37 +90,40 @@ class CachedTTFFont : public Font
                          const std::string &ch,
                          const point &p,
                          unsigned char color, float opacity = 1.0f ) override;
+        void begin_batch() override;
+        void end_batch( const SDL_Renderer_Ptr &renderer ) override;
     protected:
-        SDL_Texture_Ptr create_glyph( const SDL_Renderer_Ptr &renderer, const std::string &ch, int color );
-
-        TTF_Font_Ptr font;
-        // Maps (character code, color) to SDL_Texture*
-
-        struct key_t {
-            std::string   codepoints;
-            unsigned char color;
+        /// Where a glyph is in the atlas.
+        struct atlas_glyph {
+            /// Index into @ref atlas_pages, -1 if the glyph could not be rendered.
+            int page = -1;
+            SDL_Rect rect = { 0, 0, 0, 0 };
+        };
 
-            std::pair<std::string, unsigned char> as_pair() const {
-                return std::make_pair( codepoints, color );
-            }
+        /// Renders the glyph in white, colors are applied when drawing it.
+        SDL_Surface_Ptr create_glyph( const std::string &ch );
+        const atlas_glyph &get_glyph( const SDL_Renderer_Ptr &renderer, const std::string &ch );
+        atlas_glyph add_to_atlas( const SDL_Renderer_Ptr &renderer, const SDL_Surface_Ptr &glyph,
+                                  int cells );
 
-            friend bool operator==( const key_t &lhs, const key_t &rhs ) noexcept {
-                return lhs.as_pair() == rhs.as_pair();
-            }
-        };
+        TTF_Font_Ptr font;
 
-        struct key_t_hash {
-            size_t operator()( const key_t &k ) const {
-                return cata::auto_hash<std::pair<std::string, unsigned char>>()( k.as_pair() );
-            }
-        };
+        /// Glyphs of a single code point, by code point.
+        std::unordered_map<uint32_t, atlas_glyph> glyphs;
+        /// Glyphs of several code points (e.g. with combining characters).
+        std::unordered_map<std::string, atlas_glyph> cluster_glyphs;
 
-        struct cached_t {
-            SDL_Texture_Ptr texture;
-            int          width;
-        };
+        /// Each page holds atlas_cells x atlas_cells character cells.
+        static constexpr int atlas_cells = 32;
+        std::vector<SDL_Texture_Ptr> atlas_pages;
+        /// Next free cell on the last page.
+        point atlas_cursor;
 
-        std::unordered_map<key_t, cached_t, key_t_hash> glyph_cache_map;
+        bool batching = false;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        /// Two triangles per queued character, for each page.
+        std::vector<std::vector<SDL_Vertex>> queued_vertices;
+#endif
 
         const bool fontblending;
 };
@@ -163,6 +173,8 @@ class FontFallbackList : public Font
                          const std::string &ch,
                          const point &p,
                          unsigned char color, float opacity = 1.0f ) override;
+        void begin_batch() override;
+        void end_batch( const SDL_Renderer_Ptr &renderer ) override;
     protected:
         std::vector<std::unique_ptr<Font>> fonts;
         std::map<std::string, std::vector<std::unique_ptr<Font>>::iterator> glyph_font;
@@ -1282,6 +1282,8 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
     static const std::string space_string = " ";
 
     bool update = false;
+    // Glyphs never reach beyond their cells, so they can all be drawn after the backgrounds
+    font->begin_batch();
     for( int j = 0; j < win->height; j++ ) {
         if( !win->line[j].touched ) {
             continue;
@@ -1389,6 +1391,7 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
             }
         }
     }
+    font->end_batch( renderer );
     win->draw = false; //We drew the window, mark it as so
     //Keeping track of last drawn window and tilemode zoom level
     ::winBuffer = w.weak_ptr();
@@ -147,6 +147,19 @@ class submap
             }
         }
 
+        /**
+         * Terrain and furniture of all squares as contiguous arrays, indexed by
+         * x * SEEY + y, for reading them in bulk. nullptr for uniform submaps, all squares of
+         * which have the terrain get_ter() returns and no furniture.
+         */
+        const ter_id *get_ter_array() const {
+            return is_uniform() ? nullptr : &m->ter[0][0];
+        }
+
+        const furn_id *get_furn_array() const {
+            return is_uniform() ? nullptr : &m->frn[0][0];
+        }
+
         int get_radiation( const point &p ) const {
             if( is_uniform() ) {
                 return 0;
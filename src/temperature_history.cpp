@@ -0,0 +1,153 @@
+#include "temperature_history.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "cata_utility.h"
+#include "debug.h"
+#include "enums.h"
+#include "game.h"
+#include "game_constants.h"
+#include "item.h"
+#include "weather.h"
+#include "weather_gen.h"
+
+units::temperature environment_temperature( const weather_generator &wgen, const tripoint &pos,
+        const time_point &t, unsigned seed, temperature_flag flag,
+        units::temperature_delta temp_mod )
+{
+    // Use weather if above ground, use map temp if below
+    units::temperature env_temperature;
+    if( pos.z >= 0 && flag != temperature_flag::ROOT_CELLAR ) {
+        env_temperature = wgen.get_weather_temperature( pos, t, seed );
+    } else {
+        env_temperature = AVERAGE_ANNUAL_TEMPERATURE;
+    }
+    env_temperature += temp_mod;
+
+    switch( flag ) {
+        case temperature_flag::NORMAL:
+            // Just use the temperature normally
+            break;
+        case temperature_flag::FRIDGE:
+            env_temperature = std::min( env_temperature, temperatures::fridge );
+            break;
+        case temperature_flag::FREEZER:
+            env_temperature = std::min( env_temperature, temperatures::freezer );
+            break;
+        case temperature_flag::HEATER:
+            env_temperature = std::max( env_temperature, temperatures::normal );
+            break;
+        case temperature_flag::ROOT_CELLAR:
+            env_temperature = AVERAGE_ANNUAL_TEMPERATURE;
+            break;
+        default:
+            debugmsg( "Temperature flag enum not valid.  Using normal temperature." );
+    }
+    return env_temperature;
+}
+
+static int nearest_hour( const time_point &t )
+{
+    return static_cast<int>( std::lround( to_hours<double>( t - calendar::turn_zero ) ) );
+}
+
+temperature_history::temperature_history( const tripoint &pos, temperature_flag flag,
+        units::temperature_delta temp_mod ) : pos( pos ), flag( flag ), temp_mod( temp_mod )
+{
+}
+
+units::temperature temperature_history::sample( int hour ) const
+{
+    return environment_temperature( get_weather().get_cur_weather_gen(), pos,
+                                    calendar::turn_zero + time_duration::from_hours( hour ),
+                                    g->get_seed(), flag, temp_mod );
+}
+
+void temperature_history::cover( int first, int last )
+{
+    const int old_last = first_hour + static_cast<int>( temperatures.size() ) - 1;
+    if( !temperatures.empty() && first >= first_hour && last <= old_last ) {
+        return;
+    }
+    if( temperatures.empty() ) {
+        first_hour = first;
+        for( int hour = first; hour <= last; hour++ ) {
+            temperatures.push_back( sample( hour ) );
+        }
+    } else {
+        if( first < first_hour ) {
+            std::vector<units::temperature> earlier;
+            earlier.reserve( first_hour - first );
+            for( int hour = first; hour < first_hour; hour++ ) {
+                earlier.push_back( sample( hour ) );
+            }
+            temperatures.insert( temperatures.begin(), earlier.begin(), earlier.end() );
+            first_hour = first;
+        }
+        for( int hour = old_last + 1; hour <= last; hour++ ) {
+            temperatures.push_back( sample( hour ) );
+        }
+    }
+
+    rot.assign( 1, 0.0 );
+    rot_cold.assign( 1, 0.0 );
+    rot.reserve( temperatures.size() + 1 );
+    rot_cold.reserve( temperatures.size() + 1 );
+    for( const units::temperature &temp : temperatures ) {
+        const units::temperature cold_temp = std::min( temperatures::fridge, temp );
+        rot.push_back( rot.back() + item::calc_hourly_rotpoints_at_temp( temp ) );
+        rot_cold.push_back( rot_cold.back() + item::calc_hourly_rotpoints_at_temp( cold_temp ) );
+    }
+}
+
+units::temperature temperature_history::temperature_at( const time_point &t )
+{
+    const int hour = nearest_hour( t );
+    cover( hour, hour );
+    return temperatures[hour - first_hour];
+}
+
+double temperature_history::rot_points( const time_point &from, int hours, bool cold )
+{
+    if( hours <= 0 ) {
+        return 0.0;
+    }
+    const int first = nearest_hour( from ) + 1;
+    const int last = first + hours - 1;
+    cover( first, last );
+    const std::vector<double> &totals = cold ? rot_cold : rot;
+    return totals[last - first_hour + 1] - totals[first - first_hour];
+}
+
+static scoped_temperature_history_cache *active_history_cache = nullptr;
+
+scoped_temperature_history_cache::scoped_temperature_history_cache() :
+    outer( active_history_cache )
+{
+    active_history_cache = this;
+}
+
+scoped_temperature_history_cache::~scoped_temperature_history_cache()
+{
+    active_history_cache = outer;
+}
+
+scoped_temperature_history_cache *scoped_temperature_history_cache::active()
+{
+    return active_history_cache;
+}
+
+temperature_history &scoped_temperature_history_cache::get( const tripoint &pos,
+        temperature_flag flag, units::temperature_delta temp_mod )
+{
+    // Only submap granularity matters for the weather, see the class comment.
+    const tripoint corner( SEEX * divide_round_down( pos.x, SEEX ),
+                           SEEY * divide_round_down( pos.y, SEEY ), pos.z );
+    const auto key = std::make_tuple( corner, flag, temp_mod );
+    auto it = histories.find( key );
+    if( it == histories.end() ) {
+        it = histories.emplace( key, temperature_history( corner, flag, temp_mod ) ).first;
+    }
+    return it->second;
+}
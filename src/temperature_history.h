@@ -0,0 +1,88 @@
+#pragma once
+#ifndef CATA_SRC_TEMPERATURE_HISTORY_H
+#define CATA_SRC_TEMPERATURE_HISTORY_H
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "calendar.h"
+#include "point.h"
+#include "units.h"
+
+class weather_generator;
+enum class temperature_flag : int;
+
+/**
+ * Temperature an item is exposed to at pos and time t, before insulation.
+ * Uses the weather above ground and the average annual temperature below it,
+ * then applies temp_mod and the clamping of fridges, freezers etc.
+ */
+units::temperature environment_temperature( const weather_generator &wgen, const tripoint &pos,
+        const time_point &t, unsigned seed, temperature_flag flag,
+        units::temperature_delta temp_mod );
+
+/**
+ * Hourly environment temperatures at one spot, along with running totals of the rot points
+ * they cause, so rot over any number of hours is a single subtraction.
+ * Samples are taken at whole hours and times in between use the nearest sample.
+ */
+class temperature_history
+{
+    public:
+        temperature_history( const tripoint &pos, temperature_flag flag,
+                             units::temperature_delta temp_mod );
+
+        /** Environment temperature for the hourly step that ends at t. */
+        units::temperature temperature_at( const time_point &t );
+        /**
+         * Rot points (before spoil modifiers) accumulated over the hourly steps ending at
+         * from + 1 h ... from + hours. If cold, temperatures are capped at fridge temperature.
+         */
+        double rot_points( const time_point &from, int hours, bool cold );
+
+    private:
+        // Makes sure samples [first, last] exist, both in hours since turn_zero.
+        void cover( int first, int last );
+        units::temperature sample( int hour ) const;
+
+        tripoint pos;
+        temperature_flag flag;
+        units::temperature_delta temp_mod;
+
+        int first_hour = 0;
+        std::vector<units::temperature> temperatures;
+        // rot[i] is the sum of hourly rot points of samples [0, i)
+        std::vector<double> rot;
+        std::vector<double> rot_cold;
+};
+
+/**
+ * While an instance is alive, items catching up on time spent outside the reality bubble
+ * share temperature_history objects, instead of querying the weather generator for every
+ * hour of every item.
+ * Items in one submap use the weather at the submap's corner, the weather noise varies
+ * over thousands of tiles so this makes no practical difference.
+ */
+class scoped_temperature_history_cache
+{
+    public:
+        scoped_temperature_history_cache();
+        ~scoped_temperature_history_cache();
+        scoped_temperature_history_cache( const scoped_temperature_history_cache & ) = delete;
+        scoped_temperature_history_cache &operator=( const scoped_temperature_history_cache & ) =
+            delete;
+
+        /** The innermost live cache, or nullptr if there is none. */
+        static scoped_temperature_history_cache *active();
+
+        temperature_history &get( const tripoint &pos, temperature_flag flag,
+                                  units::temperature_delta temp_mod );
+
+    private:
+        scoped_temperature_history_cache *outer;
+        using history_key = std::tuple<tripoint, temperature_flag, units::temperature_delta>;
+        std::map<history_key, temperature_history> histories;
+};
+
+#endif // CATA_SRC_TEMPERATURE_HISTORY_H
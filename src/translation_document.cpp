@@ -1,7 +1,12 @@
 #if defined(LOCALIZE)
 
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
 #include "debug.h"
 #include "filesystem.h"
+#include "mmap_file.h"
 #include "string_formatter.h"
 #include "translation_document.h"
 #include "translation_plural_evaluator.h"
@@ -48,7 +53,7 @@ std::uint32_t TranslationDocument::GetUint32( const std::size_t byteIndex ) cons
 
 const char *TranslationDocument::GetString( const std::size_t byteIndex ) const
 {
-    return data.c_str() + byteIndex;
+    return data.data() + byteIndex;
 }
 
 std::size_t TranslationDocument::EvaluatePluralForm( std::size_t n ) const
@@ -60,25 +65,88 @@ std::size_t TranslationDocument::EvaluatePluralForm( std::size_t n ) const
     }
 }
 
-TranslationDocument::TranslationDocument( const std::string &path )
+void TranslationDocument::ReadFile()
 {
-    this->path = path;
-    std::ifstream fin( fs::u8path( path ), std::ios::in | std::ios::binary );
-    if( !fin ) {
+    std::error_code ec;
+    const std::uintmax_t file_size = fs::file_size( fs::u8path( path ), ec );
+    if( ec ) {
         throw InvalidTranslationDocumentException( path, "unable to read the file" );
     }
-    const std::uintmax_t file_size = fs::file_size( fs::u8path( path ) );
     constexpr std::size_t max_file_size = 50 * 1024 * 1024;
-    if( file_size < 20 ) {
+    // Header up to and including the hash table offset
+    if( file_size < 28 ) {
         throw InvalidTranslationDocumentException( path, "file too small" );
     }
     if( file_size > max_file_size ) {
         throw InvalidTranslationDocumentException( path, "file too large" );
     }
-    data = std::string( ( std::istreambuf_iterator<char>( fin ) ), std::istreambuf_iterator<char>() );
-    if( data.size() != file_size ) {
+    mapped_file = mmap_file::map_file( path );
+    if( mapped_file && mapped_file->len == file_size ) {
+        data = std::string_view( reinterpret_cast<const char *>( mapped_file->base ),
+                                 mapped_file->len );
+        return;
+    }
+    mapped_file.reset();
+    std::ifstream fin( fs::u8path( path ), std::ios::in | std::ios::binary );
+    if( !fin ) {
+        throw InvalidTranslationDocumentException( path, "unable to read the file" );
+    }
+    file_contents = std::make_unique<std::string>( ( std::istreambuf_iterator<char>( fin ) ),
+                    std::istreambuf_iterator<char>() );
+    if( file_contents->size() != file_size ) {
         throw InvalidTranslationDocumentException( path, "did not read the entire file" );
     }
+    data = *file_contents;
+}
+
+void TranslationDocument::ValidateStringsTable( const std::size_t table_offset,
+        const char *table_name ) const
+{
+    if( table_offset + 8ULL * number_of_strings > data.size() ) {
+        throw InvalidTranslationDocumentException( path,
+                string_format( "%s strings table offset %zu with %zu entries exceeds buffer size %zu",
+                               table_name, table_offset, number_of_strings, data.size() ) );
+    }
+    for( std::size_t i = 0; i < number_of_strings; i++ ) {
+        std::size_t length = GetUint32( table_offset + 8 * i );
+        std::size_t offset = GetUint32( table_offset + 8 * i + 4 );
+        if( offset >= data.size() || length >= data.size() || offset + length >= data.size() ) {
+            throw InvalidTranslationDocumentException( path,
+                    string_format( "%s string %zu offset %zu with length %zu exceeds buffer size %zu",
+                                   table_name, i, offset, length, data.size() ) );
+        }
+        if( data[offset + length] != '\0' ) {
+            throw InvalidTranslationDocumentException( path,
+                    string_format( "%s string %zu offset %zu with length %zu not terminated by '\\0'",
+                                   table_name, i, offset, length ) );
+        }
+    }
+}
+
+void TranslationDocument::ReadHashTable()
+{
+    hash_table_size = GetUint32( 20 );
+    hash_table_offset = GetUint32( 24 );
+    // Probing steps by 1 + hash % ( S - 2 ), so smaller tables are unusable. They are also
+    // missing from documents not written by msgfmt.
+    if( hash_table_size > 2 && hash_table_offset + 4ULL * hash_table_size <= data.size() ) {
+        return;
+    }
+    hash_table_size = 0;
+    sorted_indices.resize( number_of_strings );
+    for( std::size_t i = 0; i < number_of_strings; i++ ) {
+        sorted_indices[i] = static_cast<std::uint32_t>( i );
+    }
+    std::sort( sorted_indices.begin(), sorted_indices.end(),
+    [this]( const std::uint32_t lhs, const std::uint32_t rhs ) {
+        return strcmp( GetOriginalString( lhs ), GetOriginalString( rhs ) ) < 0;
+    } );
+}
+
+TranslationDocument::TranslationDocument( const std::string &path )
+{
+    this->path = path;
+    ReadFile();
     if( GetByte( 0 ) == 0x95U &&
         GetByte( 1 ) == 0x04U &&
         GetByte( 2 ) == 0x12U &&
@@ -103,56 +171,10 @@ TranslationDocument::TranslationDocument( const std::string &path )
     number_of_strings = GetUint32( 8 );
     original_strings_table_offset = GetUint32( 12 );
     translated_strings_table_offset = GetUint32( 16 );
-    if( original_strings_table_offset + 8ULL * number_of_strings > data.size() ) {
-        throw InvalidTranslationDocumentException( path,
-                string_format( "original strings table offset %zu with %zu entries exceeds buffer size %zu",
-                               original_strings_table_offset, number_of_strings, data.size() ) );
-    }
-    if( translated_strings_table_offset + 8ULL * number_of_strings > data.size() ) {
-        throw InvalidTranslationDocumentException( path,
-                string_format( "translated strings table offset %zu with %zu entries exceeds buffer size %zu",
-                               translated_strings_table_offset, number_of_strings, data.size() ) );
-    }
-    original_offsets.reserve( number_of_strings );
-    translated_offsets.reserve( number_of_strings );
-    for( std::size_t i = 0; i < number_of_strings; i++ ) {
-        std::size_t length = GetUint32( original_strings_table_offset + 8 * i );
-        std::size_t offset = GetUint32( original_strings_table_offset + 8 * i + 4 );
-        if( offset >= data.size() || length >= data.size() || offset + length >= data.size() ) {
-            throw InvalidTranslationDocumentException( path,
-                    string_format( "original string %zu offset %zu with length %zu exceeds buffer size %zu",
-                                   i, offset, length, data.size() ) );
-        }
-        if( data[offset + length] != '\0' ) {
-            throw InvalidTranslationDocumentException( path,
-                    string_format( "original string %zu offset %zu with length %zu not terminated by '\\0'",
-                                   i, offset, length ) );
-        }
-        original_offsets.emplace_back( offset );
-    }
-    for( std::size_t i = 0; i < number_of_strings; i++ ) {
-        std::vector<std::size_t> offsets;
-        std::size_t length = GetUint32( translated_strings_table_offset + 8 * i );
-        std::size_t offset = GetUint32( translated_strings_table_offset + 8 * i + 4 );
-        if( offset >= data.size() || length >= data.size() || offset + length >= data.size() ) {
-            throw InvalidTranslationDocumentException( path,
-                    string_format( "translated string %zu offset %zu with length %zu exceeds buffer size %zu",
-                                   i, offset, length, data.size() ) );
-        }
-        if( data[offset + length] != '\0' ) {
-            throw InvalidTranslationDocumentException( path,
-                    string_format( "translated string %zu offset %zu with length %zu not terminated by '\\0'",
-                                   i, offset, length ) );
-        }
-        offsets.emplace_back( offset );
-        for( std::size_t idx = offset; idx + 1 < offset + length; idx++ ) {
-            if( data[idx] == '\0' ) {
-                offsets.emplace_back( idx + 1 );
-            }
-        }
-        translated_offsets.emplace_back( offsets );
-    }
-    const std::string metadata( GetTranslatedString( 0 ) );
+    ValidateStringsTable( original_strings_table_offset, "original" );
+    ValidateStringsTable( translated_strings_table_offset, "translated" );
+    ReadHashTable();
+    const std::string metadata( number_of_strings > 0 ? GetTranslatedString( 0 ) : "" );
     const std::string plural_rules_header( "Plural-Forms:" );
     std::size_t plural_rules_header_pos = metadata.find( plural_rules_header );
     if( plural_rules_header_pos != std::string::npos ) {
@@ -193,24 +215,89 @@ std::size_t TranslationDocument::Count() const
 
 const char *TranslationDocument::GetOriginalString( const std::size_t index ) const
 {
-    return GetString( original_offsets[index] );
+    return GetString( GetUint32( original_strings_table_offset + 8 * index + 4 ) );
 }
 
 const char *TranslationDocument::GetTranslatedString( const std::size_t index ) const
 {
-    return GetString( translated_offsets[index][0] );
+    return GetString( GetUint32( translated_strings_table_offset + 8 * index + 4 ) );
 }
 
 const char *TranslationDocument::GetTranslatedStringPlural( const std::size_t index,
         std::size_t n ) const
 {
     std::size_t plural_form = EvaluatePluralForm( n );
-    if( plural_form >= translated_offsets[index].size() ) {
-        DebugLog( D_ERROR, DC_ALL ) << "Plural forms expression evaluated out-of-bound at string entry " <<
-                                    index << " with n=" << n;
-        return GetString( translated_offsets[index][0] );
+    const std::size_t length = GetUint32( translated_strings_table_offset + 8 * index );
+    const std::size_t offset = GetUint32( translated_strings_table_offset + 8 * index + 4 );
+    // The plural forms follow each other, separated by '\0'
+    std::size_t form_offset = offset;
+    for( std::size_t form = 0; form < plural_form; form++ ) {
+        const std::size_t end = data.find( '\0', form_offset );
+        if( end + 1 >= offset + length ) {
+            DebugLog( D_ERROR, DC_ALL ) << "Plural forms expression evaluated out-of-bound at string entry " <<
+                                        index << " with n=" << n;
+            return GetString( offset );
+        }
+        form_offset = end + 1;
+    }
+    return GetString( form_offset );
+}
+
+std::uint32_t TranslationDocument::Hash( const char *str )
+{
+    // Same as gettext's hash_string on LP64, where the intermediate value can exceed 32 bits
+    std::uint64_t hash = 0;
+    while( *str != '\0' ) {
+        hash <<= 4;
+        hash += static_cast<unsigned char>( *str++ );
+        const std::uint64_t high = hash & ( ~std::uint64_t( 0 ) << 28 );
+        if( high != 0 ) {
+            hash ^= high >> 24;
+            hash ^= high;
+        }
+    }
+    return static_cast<std::uint32_t>( hash );
+}
+
+std::optional<std::size_t> TranslationDocument::Find( const char *query ) const
+{
+    return Find( query, Hash( query ) );
+}
+
+std::optional<std::size_t> TranslationDocument::Find( const char *query,
+        const std::uint32_t hash ) const
+{
+    if( query[0] == '\0' ) {
+        return std::nullopt;
+    }
+    if( hash_table_size == 0 ) {
+        const auto it = std::lower_bound( sorted_indices.begin(), sorted_indices.end(), query,
+        [this]( const std::uint32_t index, const char *str ) {
+            return strcmp( GetOriginalString( index ), str ) < 0;
+        } );
+        if( it != sorted_indices.end() && strcmp( GetOriginalString( *it ), query ) == 0 ) {
+            return *it;
+        }
+        return std::nullopt;
+    }
+    // Open addressing with double hashing, as in gettext's dcigettext.c. The probing visits
+    // every slot since S is prime, a full table without the string is only a corrupt one.
+    std::size_t slot = hash % hash_table_size;
+    const std::size_t step = 1 + hash % ( hash_table_size - 2 );
+    for( std::size_t probes = 0; probes < hash_table_size; probes++ ) {
+        const std::uint32_t entry = GetUint32( hash_table_offset + 4 * slot );
+        if( entry == 0 ) {
+            return std::nullopt;
+        }
+        // Entries are 1-based, 0 marks an empty slot. The original of a plural entry is the
+        // singular and the plural separated by '\0', so comparing stops at the singular.
+        const std::size_t index = entry - 1;
+        if( index < number_of_strings && strcmp( GetOriginalString( index ), query ) == 0 ) {
+            return index;
+        }
+        slot = slot + step >= hash_table_size ? slot + step - hash_table_size : slot + step;
     }
-    return GetString( translated_offsets[index][plural_form] );
+    return std::nullopt;
 }
 
 #endif // defined(LOCALIZE)
@@ -6,11 +6,15 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "translation_plural_evaluator.h"
 
+class mmap_file;
+
 class InvalidTranslationDocumentException : public std::exception
 {
     private:
@@ -28,6 +32,8 @@ enum class Endianness {
 /**
  * Represents a GNU gettext Message Object (.mo) document
  * Format specification: https://www.gnu.org/software/gettext/manual/html_node/MO-Files.html
+ * The file is memory-mapped when possible, strings are looked up in place through the hash
+ * table msgfmt writes into the file.
  */
 class TranslationDocument
 {
@@ -36,12 +42,15 @@ class TranslationDocument
         std::size_t number_of_strings; // N
         std::size_t original_strings_table_offset; // O
         std::size_t translated_strings_table_offset; // T
-        // std::size_t hash_table_size; // S
-        // std::size_t hash_table_offset; // H
-        std::string data;
+        std::size_t hash_table_size; // S
+        std::size_t hash_table_offset; // H
+        // Contents of the file, in either of the following
+        std::string_view data;
+        std::shared_ptr<mmap_file> mapped_file;
+        std::unique_ptr<std::string> file_contents;
         Endianness endianness;
-        std::vector<std::size_t> original_offsets;
-        std::vector<std::vector<std::size_t>> translated_offsets;
+        // Indices of the strings by original string, for documents without a hash table
+        std::vector<std::uint32_t> sorted_indices;
         std::unique_ptr<TranslationPluralRulesEvaluator> plural_rules;
 
         std::uint8_t GetByte( std::size_t byteIndex ) const;
@@ -51,11 +60,24 @@ class TranslationDocument
         std::uint32_t GetUint32( std::size_t byteIndex ) const;
         const char *GetString( std::size_t byteIndex ) const;
         std::size_t EvaluatePluralForm( std::size_t n ) const;
+        void ReadFile();
+        void ValidateStringsTable( std::size_t table_offset, const char *table_name ) const;
+        void ReadHashTable();
     public:
         TranslationDocument() = delete;
         explicit TranslationDocument( const std::string &path );
 
+        /** gettext's hashpjw, which the hash tables of .mo files are built with. */
+        static std::uint32_t Hash( const char *str );
+
         std::size_t Count() const;
+        /** Index of the string whose original is query, the header entry is never found. */
+        std::optional<std::size_t> Find( const char *query ) const;
+        /**
+         * Same as above, with the query already hashed by @ref Hash, so that looking it up in
+         * several documents hashes it only once.
+         */
+        std::optional<std::size_t> Find( const char *query, std::uint32_t hash ) const;
         const char *GetOriginalString( std::size_t index ) const;
         const char *GetTranslatedString( std::size_t index ) const;
         const char *GetTranslatedStringPlural( std::size_t index, std::size_t n ) const;
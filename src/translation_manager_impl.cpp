@@ -1,5 +1,6 @@
 #if defined(LOCALIZE)
 
+#include <cstdint>
 #include <cstring>
 
 #include "cached_options.h"
@@ -9,28 +10,16 @@
 #include "translations.h"
 #include "translation_manager_impl.h"
 
-std::uint32_t TranslationManager::Impl::Hash( const char *str )
-{
-    std::uint32_t hash = 5381U;
-    while( *str != '\0' ) {
-        hash = hash * 33 + ( *str++ );
-    }
-    return hash;
-}
-
 std::optional<std::pair<std::size_t, std::size_t>> TranslationManager::Impl::LookupString(
             const char *query ) const
 {
-    std::uint32_t hash = Hash( query );
-    auto it = strings.find( hash );
-    if( it == strings.end() ) {
-        return std::nullopt;
-    }
-    for( const std::pair<size_t, size_t> &entry : it->second ) {
-        const std::size_t document = entry.first;
-        const std::size_t index = entry.second;
-        if( strcmp( documents[document].GetOriginalString( index ), query ) == 0 ) {
-            return std::optional<std::pair<std::size_t, std::size_t>> { entry };
+    LoadPendingDocuments();
+    const std::uint32_t hash = TranslationDocument::Hash( query );
+    // The first document having the string wins
+    for( std::size_t document = 0; document < documents.size(); document++ ) {
+        const std::optional<std::size_t> index = documents[document].Find( query, hash );
+        if( index ) {
+            return std::make_pair( document, *index );
         }
     }
     return std::nullopt;
@@ -82,8 +71,7 @@ void TranslationManager::Impl::ScanTranslationDocuments()
 void TranslationManager::Impl::Reset()
 {
     documents.clear();
-    strings.clear();
-    strings.max_load_factor( 1.0f );
+    pending_files.reset();
 }
 
 TranslationManager::Impl::Impl()
@@ -116,7 +104,8 @@ void TranslationManager::Impl::SetLanguage( const std::string &language_code )
         Reset();
         return;
     }
-    LoadDocuments( mo_files[current_language_code] );
+    Reset();
+    pending_files = mo_files[current_language_code];
 }
 
 std::string TranslationManager::Impl::GetCurrentLanguage() const
@@ -124,9 +113,10 @@ std::string TranslationManager::Impl::GetCurrentLanguage() const
     return current_language_code;
 }
 
-void TranslationManager::Impl::LoadDocuments( const std::vector<std::string> &files )
+std::vector<TranslationDocument> TranslationManager::Impl::ReadDocuments(
+    const std::vector<std::string> &files )
 {
-    Reset();
+    std::vector<TranslationDocument> read;
     for( const std::string &file : files ) {
         try {
             // Skip loading MO files from TEST_DATA mods if not in test mode
@@ -136,26 +126,29 @@ void TranslationManager::Impl::LoadDocuments( const std::vector<std::string> &fi
                 }
             }
             if( file_exist( file ) ) {
-                documents.emplace_back( file );
+                read.emplace_back( file );
             }
         } catch( const InvalidTranslationDocumentException &e ) {
             DebugLog( D_ERROR, DC_ALL ) << e.what();
         }
     }
-    for( std::size_t document = 0; document < documents.size(); document++ ) {
-        for( std::size_t i = 0; i < documents[document].Count(); i++ ) {
-            const char *message = documents[document].GetOriginalString( i );
-            if( message[0] != '\0' ) {
-                const std::uint32_t hash = Hash( message );
-                if( strings.count( hash ) == 0 ) {
-                    strings[hash] = std::vector<std::pair<std::size_t, std::size_t>>( 1 );
-                }
-                strings[hash].emplace_back( document, i );
-            }
-        }
+    return read;
+}
+
+void TranslationManager::Impl::LoadPendingDocuments() const
+{
+    if( pending_files ) {
+        documents = ReadDocuments( *pending_files );
+        pending_files.reset();
     }
 }
 
+void TranslationManager::Impl::LoadDocuments( const std::vector<std::string> &files )
+{
+    Reset();
+    documents = ReadDocuments( files );
+}
+
 const char *TranslationManager::Impl::Translate( const std::string &message ) const
 {
     return Translate( message.c_str() );
@@ -5,7 +5,9 @@
 #if defined(LOCALIZE)
 
 #include <optional>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "translation_document.h"
 #include "translation_manager.h"
@@ -13,10 +15,13 @@
 class TranslationManager::Impl
 {
     private:
-        std::vector<TranslationDocument> documents;
-
-        std::unordered_map<std::uint32_t, std::vector<std::pair<std::size_t, std::size_t>>> strings;
-        static std::uint32_t Hash( const char *str );
+        // Loaded on the first lookup after the language changed, switching languages several
+        // times in a row or to a language nothing is displayed in costs nothing.
+        mutable std::vector<TranslationDocument> documents;
+        mutable std::optional<std::vector<std::string>> pending_files;
+        static std::vector<TranslationDocument> ReadDocuments(
+            const std::vector<std::string> &files );
+        void LoadPendingDocuments() const;
         std::optional<std::pair<std::size_t, std::size_t>> LookupString( const char *query ) const;
 
         std::unordered_map<std::string, std::vector<std::string>> mo_files;
@@ -0,0 +1,117 @@
+#include "trigram_index.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+#include "cached_options.h"
+#include "catacharset.h"
+#include "unicode.h"
+
+static uint64_t make_trigram( char32_t a, char32_t b, char32_t c )
+{
+    constexpr uint64_t mask = ( 1 << 21 ) - 1;
+    return ( ( a & mask ) << 42 ) | ( ( b & mask ) << 21 ) | ( c & mask );
+}
+
+template<typename Func>
+static void for_each_trigram( const std::u32string &str, Func func )
+{
+    for( size_t i = 0; i + 2 < str.size(); i++ ) {
+        func( make_trigram( str[i], str[i + 1], str[i + 2] ) );
+    }
+}
+
+void trigram_index::add( const doc_id doc, const std::string_view text )
+{
+    std::u32string str = utf8_to_utf32( text );
+    std::for_each( str.begin(), str.end(), u32_to_lowercase );
+    for_each_trigram( str, [&]( trigram t ) {
+        pending.emplace_back( t, doc );
+    } );
+    // lcmatch also accepts texts that contain the query once their accents are removed
+    const std::u32string lower = str;
+    std::for_each( str.begin(), str.end(), remove_accent );
+    if( str != lower ) {
+        for_each_trigram( str, [&]( trigram t ) {
+            pending.emplace_back( t, doc );
+        } );
+    }
+}
+
+void trigram_index::finalize()
+{
+    for( size_t i = 0; i < keys.size(); i++ ) {
+        for( uint32_t j = offsets[i]; j < offsets[i + 1]; j++ ) {
+            pending.emplace_back( keys[i], docs[j] );
+        }
+    }
+    std::sort( pending.begin(), pending.end() );
+    pending.erase( std::unique( pending.begin(), pending.end() ), pending.end() );
+
+    keys.clear();
+    offsets.clear();
+    docs.clear();
+    docs.reserve( pending.size() );
+    for( const std::pair<trigram, doc_id> &e : pending ) {
+        if( keys.empty() || keys.back() != e.first ) {
+            keys.push_back( e.first );
+            offsets.push_back( docs.size() );
+        }
+        docs.push_back( e.second );
+    }
+    offsets.push_back( docs.size() );
+    pending.clear();
+    pending.shrink_to_fit();
+}
+
+std::optional<std::vector<trigram_index::doc_id>> trigram_index::candidates(
+            const std::string_view qry ) const
+{
+    if( use_pinyin_search ) {
+        return std::nullopt;
+    }
+    std::u32string str = utf8_to_utf32( qry );
+    if( str.size() < 3 ) {
+        return std::nullopt;
+    }
+    std::for_each( str.begin(), str.end(), u32_to_lowercase );
+
+    // Posting lists of all the query's trigrams, intersected starting from the shortest one.
+    std::vector<std::pair<uint32_t, uint32_t>> lists;
+    bool missing = false;
+    for_each_trigram( str, [&]( trigram t ) {
+        const auto it = std::lower_bound( keys.begin(), keys.end(), t );
+        if( it == keys.end() || *it != t ) {
+            missing = true;
+            return;
+        }
+        const size_t i = std::distance( keys.begin(), it );
+        lists.emplace_back( offsets[i], offsets[i + 1] );
+    } );
+    std::vector<doc_id> result;
+    if( missing ) {
+        return result;
+    }
+    std::sort( lists.begin(), lists.end(), []( const auto & l, const auto & r ) {
+        return l.second - l.first < r.second - r.first;
+    } );
+    result.assign( docs.begin() + lists.front().first, docs.begin() + lists.front().second );
+    std::vector<doc_id> next;
+    for( size_t i = 1; i < lists.size() && !result.empty(); i++ ) {
+        next.clear();
+        std::set_intersection( result.begin(), result.end(),
+                               docs.begin() + lists[i].first, docs.begin() + lists[i].second,
+                               std::back_inserter( next ) );
+        result.swap( next );
+    }
+    return result;
+}
+
+void trigram_index::clear()
+{
+    pending.clear();
+    keys.clear();
+    offsets.clear();
+    docs.clear();
+}
@@ -0,0 +1,54 @@
+#pragma once
+#ifndef CATA_SRC_TRIGRAM_INDEX_H
+#define CATA_SRC_TRIGRAM_INDEX_H
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * Inverted index from the three-letter substrings of some texts to the documents containing them.
+ *
+ * Used to narrow down the candidates of an @ref lcmatch search before running the exact (and much
+ * slower) match on each of them: every document that lcmatch would accept is among the candidates,
+ * but the candidates may contain false positives.
+ * Texts are indexed both lower cased and with accents removed, mirroring lcmatch.
+ */
+class trigram_index
+{
+    public:
+        using doc_id = uint32_t;
+
+        /** Adds text to the document doc. A document can have any number of texts. */
+        void add( doc_id doc, std::string_view text );
+        /** Must be called after the last @ref add and before the first @ref candidates. */
+        void finalize();
+
+        /**
+         * Documents that may contain qry, sorted by id.
+         * Returns nullopt if qry is too short to narrow anything down, or if lcmatch may match
+         * texts that do not contain it (pinyin search).
+         */
+        std::optional<std::vector<doc_id>> candidates( std::string_view qry ) const;
+
+        bool empty() const {
+            return keys.empty() && pending.empty();
+        }
+        void clear();
+
+    private:
+        // The three lower cased code points of a trigram, 21 bits each.
+        using trigram = uint64_t;
+
+        // Filled by add(), turned into the arrays below by finalize().
+        std::vector<std::pair<trigram, doc_id>> pending;
+
+        // Posting list of keys[i] is docs[offsets[i]] ... docs[offsets[i + 1] - 1].
+        std::vector<trigram> keys;
+        std::vector<uint32_t> offsets;
+        std::vector<doc_id> docs;
+};
+
+#endif // CATA_SRC_TRIGRAM_INDEX_H
@@ -401,6 +401,7 @@ void vpart_info::load( const JsonObject &jo, const std::string &src )
 void vpart_info::set_flag( const std::string &flag )
 {
     flags.insert( flag );
+    interned_flags.set( interned_flag( flag ) );
     const auto iter = vpart_bitflag_map.find( flag );
     if( iter != vpart_bitflag_map.end() ) {
         bitflags.set( iter->second );
@@ -593,6 +594,7 @@ void vpart_info::finalize()
             set_flag( flag ); // refresh bitflags field
         }
     }
+    interned_flags.assign( flags );
 
     if( has_flag( VPFLAG_APPLIANCE ) ) {
         // force all appliances' location field to "structure"
@@ -19,6 +19,7 @@
 #include "color.h"
 #include "compatibility.h"
 #include "damage.h"
+#include "interned_flag.h"
 #include "point.h"
 #include "requirements.h"
 #include "translations.h"
@@ -245,6 +246,9 @@ class vpart_info
         bool has_flag( const vpart_bitflags flag ) const {
             return bitflags.test( flag );
         }
+        bool has_flag( const interned_flag &flag ) const {
+            return interned_flags.has( flag );
+        }
         void set_flag( const std::string &flag );
 
         /** Gets all categories of this part */
@@ -323,6 +327,8 @@ class vpart_info
         std::set<std::string> categories;
         // flags checked so often that things slow down due to string cmp
         std::bitset<NUM_VPFLAGS> bitflags;
+        // all the flags, by interned index, rebuilt in finalize()
+        interned_flag_set interned_flags;
 
         /** Second field is the multiplier */
         std::vector<std::pair<requirement_id, int>> install_reqs;
@@ -43,6 +43,7 @@
 #include "field_type.h"
 #include "flag.h"
 #include "game.h"
+#include "interned_flag.h"
 #include "item.h"
 #include "item_group.h"
 #include "item_pocket.h"
@@ -124,6 +125,8 @@ static const std::string flag_E_COMBUSTION( "E_COMBUSTION" );
 
 static const std::string flag_APPLIANCE( "APPLIANCE" );
 
+static const interned_flag flag_POWER_TRANSFER( "POWER_TRANSFER" );
+
 static bool is_sm_tile_outside( const tripoint &real_global_pos );
 static bool is_sm_tile_over_water( const tripoint &real_global_pos );
 
@@ -171,7 +174,7 @@ void vehicle_stack::insert( const item &newitem )
 
 units::volume vehicle_stack::max_volume() const
 {
-    if( myorigin->part_flag( part_num, "CARGO" ) && !myorigin->part( part_num ).is_broken() ) {
+    if( myorigin->part_flag( part_num, VPFLAG_CARGO ) && !myorigin->part( part_num ).is_broken() ) {
         // Set max volume for vehicle cargo to prevent integer overflow
         return std::min( myorigin->part( part_num ).info().size, 10000_liter );
     }
@@ -1151,7 +1154,7 @@ ret_val<void> vehicle::can_mount( const point &dp, const vpart_info &vpi ) const
     for( const int elem : parts_in_square ) {
         const vpart_info &vpi_other = part( elem ).info();
         // No part type can stack with itself, except power cables
-        if( vpi.id == vpi_other.id && !vpi.has_flag( "POWER_TRANSFER" ) ) {
+        if( vpi.id == vpi_other.id && !vpi.has_flag( flag_POWER_TRANSFER ) ) {
             return ret_val<void>::make_failure( _( "%s is already installed here." ), vpi.name() );
         }
         // Only parts with empty or different locations can be on same tile
@@ -1901,7 +1904,7 @@ bool vehicle::remove_part( const int p, RemovePartHandler &handler )
     const auto lz_iter = loot_zones.find( parts[p].mount );
     const bool no_zone = lz_iter != loot_zones.end();
 
-    if( no_zone && part_flag( p, "CARGO" ) ) {
+    if( no_zone && part_flag( p, VPFLAG_CARGO ) ) {
         // Using the key here (instead of the iterator) will remove all zones on
         // this mount points regardless of how many there are
         loot_zones.erase( parts[p].mount );
@@ -3013,6 +3016,15 @@ bool vehicle::part_flag( int part, const vpart_bitflags flag ) const
     }
 }
 
+bool vehicle::part_flag( int part, const interned_flag &flag ) const
+{
+    if( part < 0 || part >= static_cast<int>( parts.size() ) || parts[part].removed ) {
+        return false;
+    } else {
+        return part_info( part ).has_flag( flag );
+    }
+}
+
 int vehicle::part_at( const point &dp ) const
 {
     for( const vpart_reference &vp : get_all_parts() ) {
@@ -5100,7 +5112,7 @@ std::map<Vehicle *, float> vehicle::search_connected_vehicles( Vehicle *start )
         for( const int part_idx : veh->loose_parts ) { // graph "edges" are POWER_TRANSFER parts
             const vehicle_part &vp = veh->part( part_idx );
             const vpart_info &vpi = vp.info();
-            if( !vpi.has_flag( "POWER_TRANSFER" ) ) {
+            if( !vpi.has_flag( flag_POWER_TRANSFER ) ) {
                 continue;
             }
 
@@ -5686,7 +5698,7 @@ void vehicle::place_spawn_items()
 
     const float spawn_rate = get_option<float>( "ITEM_SPAWNRATE" );
     for( const vehicle_item_spawn &spawn : type->item_spawns ) {
-        int part = part_with_feature( spawn.pos, "CARGO", false );
+        int part = part_with_feature( spawn.pos, VPFLAG_CARGO, false );
         if( part < 0 ) {
             debugmsg( "No CARGO parts at (%d, %d) of %s!", spawn.pos.x, spawn.pos.y, name );
         } else {
@@ -6662,7 +6674,8 @@ void vehicle::remove_remote_part( int part_num )
             int remote_partnum = veh->loose_parts[j];
             const vehicle_part *remote_part = &veh->parts[remote_partnum];
 
-            if( veh->part_flag( remote_partnum, "POWER_TRANSFER" ) && remote_part->target.first == local_abs ) {
+            if( veh->part_flag( remote_partnum, flag_POWER_TRANSFER ) &&
+                remote_part->target.first == local_abs ) {
                 veh->remove_part( remote_partnum );
                 return;
             }
@@ -6681,7 +6694,7 @@ void vehicle::shed_loose_parts( const tripoint_bub_ms *src, const tripoint_bub_m
             // part was removed elsewhere
             continue;
         }
-        if( part_flag( elem, "POWER_TRANSFER" ) ) {
+        if( part_flag( elem, flag_POWER_TRANSFER ) ) {
             int distance = rl_dist( here.getabs( bub_part_pos( parts[elem] ) ), parts[elem].target.second );
             int max_dist = parts[elem].get_base().type->maximum_charges();
             if( src && ( max_dist - distance ) > 0 ) {
@@ -6689,7 +6702,7 @@ void vehicle::shed_loose_parts( const tripoint_bub_ms *src, const tripoint_bub_m
                 vehicle *veh = find_vehicle( parts[elem].target.second );
                 if( veh != nullptr ) {
                     for( int remote_lp : veh->loose_parts ) {
-                        if( veh->part_flag( remote_lp, "POWER_TRANSFER" ) &&
+                        if( veh->part_flag( remote_lp, flag_POWER_TRANSFER ) &&
                             veh->parts[remote_lp].target.first == here.getabs( *src ) ) {
                             // update remote part's target to new position
                             veh->parts[remote_lp].target.first = here.getabs( dst ? *dst : bub_part_pos( elem ) );
@@ -6998,7 +7011,7 @@ int vehicle::break_off( map &here, int p, int dmg )
                 add_msg_if_player_sees( pos, m_bad, _( "The %1$s's %2$s is disconnected!" ), name,
                                         parts[ parts_in_square[ index ] ].name() );
                 invalidate_towing( true );
-            } else if( part_flag( parts_in_square[ index ], "POWER_TRANSFER" ) ) {
+            } else if( part_flag( parts_in_square[ index ], flag_POWER_TRANSFER ) ) {
                 // Electrical cables - remove it in one piece and remove remote part
                 add_msg_if_player_sees( pos, m_bad, _( "The %1$s's %2$s is disconnected!" ), name,
                                         parts[ parts_in_square[ index ] ].name() );
@@ -7032,7 +7045,7 @@ int vehicle::break_off( map &here, int p, int dmg )
             add_msg_if_player_sees( pos, m_bad, _( "The %1$s's %2$s is disconnected!" ), name,
                                     parts[ p ].name() );
             invalidate_towing( true );
-        } else if( part_flag( p, "POWER_TRANSFER" ) ) {
+        } else if( part_flag( p, flag_POWER_TRANSFER ) ) {
             // Electrical cables - remove it in one piece and remove remote part
             add_msg_if_player_sees( pos, m_bad, _( "The %1$s's %2$s is disconnected!" ), name,
                                     parts[ p ].name() );
@@ -7068,7 +7081,7 @@ int vehicle::break_off( map &here, int p, int dmg )
                     if( part_flag( part, "TOW_CABLE" ) ) {
                         invalidate_towing( true );
                     } else {
-                        if( part_flag( p, "POWER_TRANSFER" ) ) {
+                        if( part_flag( p, flag_POWER_TRANSFER ) ) {
                             remove_remote_part( part );
                         }
                         item part_as_item = parts[part].properties_to_item();
@@ -7177,7 +7190,7 @@ int vehicle::damage_direct( map &here, int p, int dmg, const damage_type_id &typ
             item part_as_item = parts[p].properties_to_item();
             add_msg_if_player_sees( global_part_pos3( p ), m_bad, _( "The %1$s's %2$s is disconnected!" ), name,
                                     parts[p].name() );
-            if( part_flag( p, "POWER_TRANSFER" ) ) {
+            if( part_flag( p, flag_POWER_TRANSFER ) ) {
                 remove_remote_part( p );
                 part_as_item.set_damage( 0 );
             } else {
@@ -7402,7 +7415,7 @@ std::list<item> vehicle::use_charges( const vpart_position &vp, const itype_id &
                                    ? itype_water_faucet
                                    : type;
     const std::optional<vpart_reference> tool_vp = vp.part_with_tool( veh_tool_type );
-    const std::optional<vpart_reference> cargo_vp = vp.part_with_feature( "CARGO", true );
+    const std::optional<vpart_reference> cargo_vp = vp.part_with_feature( VPFLAG_CARGO, true );
 
     if( tool_vp ) { // handle vehicle tools
         const itype_id &tool_fuel_type = type->tool_slot_first_ammo();
@@ -7876,7 +7889,7 @@ bool vehicle::refresh_zones()
             zone_data zone = z.second;
             //Get the global position of the first cargo part at the relative coordinate
 
-            const int part_idx = part_with_feature( z.first, "CARGO", false );
+            const int part_idx = part_with_feature( z.first, VPFLAG_CARGO, false );
             if( part_idx == -1 ) {
                 debugmsg( "Could not find cargo part at %d,%d on vehicle %s for loot zone.  Removing loot zone.",
                           z.first.x, z.first.y, this->name );
@@ -42,6 +42,7 @@ class Character;
 class Creature;
 class JsonObject;
 class JsonOut;
+class interned_flag;
 class map;
 class monster;
 class nc_color;
@@ -1291,6 +1292,7 @@ class vehicle
         // returns true if given flag is present for given part index
         bool part_flag( int p, const std::string &f ) const;
         bool part_flag( int p, vpart_bitflags f ) const;
+        bool part_flag( int p, const interned_flag &f ) const;
 
         // Translate mount coordinates "p" using current pivot direction and anchor and return tile coordinates
         point coord_translate( const point &p ) const;
@@ -0,0 +1,71 @@
+#include "vision_pair_cache.h"
+
+#include <algorithm>
+
+#include "game_constants.h"
+#include "point.h"
+
+static constexpr size_t slot_count = size_t( 1 ) << vision_pair_cache::slot_bits;
+static constexpr std::uint64_t slot_used = 2;
+
+static_assert( MAPSIZE_X <= 256 && MAPSIZE_Y <= 256 && OVERMAP_LAYERS <= 256,
+               "tiles of the bubble must pack into 24 bits" );
+
+static std::uint64_t pack( const tripoint &p )
+{
+    return static_cast<std::uint64_t>( p.x ) << 16 | static_cast<std::uint64_t>( p.y ) << 8 |
+           static_cast<std::uint64_t>( p.z + OVERMAP_DEPTH );
+}
+
+// Same key for both orders of the pair
+static std::uint64_t pair_key( const tripoint &a, const tripoint &b )
+{
+    const std::uint64_t pa = pack( a );
+    const std::uint64_t pb = pack( b );
+    return pa < pb ? pa << 24 | pb : pb << 24 | pa;
+}
+
+size_t vision_pair_cache::find_slot( const std::uint64_t key ) const
+{
+    // Fibonacci hashing, the table size is a power of two
+    size_t slot = static_cast<size_t>( ( key * 0x9E3779B97F4A7C15ULL ) >> ( 64 - slot_bits ) );
+    while( ( slots[slot] & slot_used ) != 0 && ( slots[slot] >> 2 ) != key ) {
+        slot = ( slot + 1 ) & ( slot_count - 1 );
+    }
+    return slot;
+}
+
+int vision_pair_cache::get( const tripoint &a, const tripoint &b ) const
+{
+    if( used == 0 ) {
+        return -1;
+    }
+    const std::uint64_t entry = slots[find_slot( pair_key( a, b ) )];
+    if( ( entry & slot_used ) == 0 ) {
+        return -1;
+    }
+    return static_cast<int>( entry & 1 );
+}
+
+void vision_pair_cache::insert( const tripoint &a, const tripoint &b, const bool visible )
+{
+    if( slots.empty() ) {
+        slots.resize( slot_count );
+    } else if( used >= max_size ) {
+        clear();
+    }
+    const std::uint64_t key = pair_key( a, b );
+    std::uint64_t &entry = slots[find_slot( key )];
+    if( ( entry & slot_used ) == 0 ) {
+        used++;
+    }
+    entry = key << 2 | slot_used | ( visible ? 1 : 0 );
+}
+
+void vision_pair_cache::clear()
+{
+    if( used != 0 ) {
+        std::fill( slots.begin(), slots.end(), 0 );
+        used = 0;
+    }
+}
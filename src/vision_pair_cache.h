@@ -0,0 +1,40 @@
+#pragma once
+#ifndef CATA_SRC_VISION_PAIR_CACHE_H
+#define CATA_SRC_VISION_PAIR_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct tripoint;
+
+/**
+ * Results of @ref map::sees by pair of tiles in the reality bubble, in a fixed-size open
+ * addressing table. A pair is stored under the same key whichever end is asked about first,
+ * which keeps visibility reflexive. Once the table is three quarters full it is cleared.
+ */
+class vision_pair_cache
+{
+    public:
+        /** Returns 1 if the pair was seen, 0 if not, -1 if it is not in the cache. */
+        int get( const tripoint &a, const tripoint &b ) const;
+        void insert( const tripoint &a, const tripoint &b, bool visible );
+        void clear();
+
+        size_t size() const {
+            return used;
+        }
+
+        static constexpr int slot_bits = 17;
+        /** Pairs kept at most before the table is cleared, about as many as the old LRU. */
+        static constexpr size_t max_size = ( size_t( 1 ) << slot_bits ) / 4 * 3;
+
+    private:
+        /** Key shifted left by 2, one bit marking the slot as used, and the result. */
+        std::vector<std::uint64_t> slots;
+        size_t used = 0;
+
+        size_t find_slot( std::uint64_t key ) const;
+};
+
+#endif // CATA_SRC_VISION_PAIR_CACHE_H
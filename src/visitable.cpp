@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "active_item_cache.h"
@@ -19,6 +20,7 @@
 #include "inventory.h"
 #include "item.h"
 #include "item_contents.h"
+#include "item_index.h"
 #include "item_pocket.h"
 #include "make_static.h"
 #include "map.h"
@@ -205,7 +207,13 @@ bool Character::has_quality( const quality_id &qual, int level, int qty ) const
         }
     }
 
-    return qty <= 0 ? true : has_quality_internal( *this, qual, level, qty ) == qty;
+    if( qty <= 0 ) {
+        return true;
+    }
+    if( const item_index *index = get_item_index() ) {
+        return index->has_quality( qual, level, qty ) == qty;
+    }
+    return has_quality_internal( *this, qual, level, qty ) == qty;
 }
 
 bool read_only_visitable::has_tools( const itype_id &it, int quantity,
@@ -278,6 +286,9 @@ int Character::max_quality( const quality_id &qual ) const
         }
     }
 
+    if( const item_index *index = get_item_index() ) {
+        return std::max( res, index->max_quality( qual ) );
+    }
     return std::max( res, max_quality_internal( *this, qual ) );
 }
 
@@ -646,6 +657,7 @@ std::list<item> Character::remove_items_with( const
         // nothing to do
         return res;
     }
+    invalidate_item_index();
 
     // first try and remove items from the inventory
     res = inv->remove_items_with( filter, count );
@@ -788,42 +800,37 @@ std::list<item> vehicle_selector::remove_items_with( const
     return res;
 }
 
-template <typename T, typename M>
-static int charges_of_internal( const T &self, const M &main, const itype_id &id, int limit,
-                                const std::function<bool( const item & )> &filter,
-                                const std::function<void( int )> &visitor, bool in_tools )
+// Adds the charges of an item to qty if it is one charges_of() counts for id
+static void count_charges( const item &e, const itype_id &id,
+                           const std::function<bool( const item & )> &filter, bool in_tools,
+                           int &qty, bool &found_tool_with_UPS, bool &found_bionic_tool )
 {
-    int qty = 0;
-
-    bool found_tool_with_UPS = false;
-    bool found_bionic_tool = false;
-    self.visit_items( [&]( const item * e, item * ) {
-        if( filter( *e ) &&
-            ( id == e->typeId() || ( in_tools && id == e->ammo_current() ) ||
-              ( id == itype_UPS && e->has_flag( flag_IS_UPS ) ) ) &&
-            !e->is_broken() ) {
-            if( id != itype_UPS ) {
-                if( e->count_by_charges() ) {
-                    qty = sum_no_wrap( qty, e->charges );
-                } else {
-                    qty = sum_no_wrap( qty, e->ammo_remaining() );
-                }
-                if( e->has_flag( STATIC( flag_id( "USE_UPS" ) ) ) ) {
-                    found_tool_with_UPS = true;
-                } else if( e->has_flag( STATIC( flag_id( "USES_BIONIC_POWER" ) ) ) ) {
-                    found_bionic_tool = true;
-                }
-            } else if( id == itype_UPS && e->has_flag( flag_IS_UPS ) ) {
-                qty = sum_no_wrap( qty, e->ammo_remaining() );
+    if( filter( e ) &&
+        ( id == e.typeId() || ( in_tools && id == e.ammo_current() ) ||
+          ( id == itype_UPS && e.has_flag( flag_IS_UPS ) ) ) &&
+        !e.is_broken() ) {
+        if( id != itype_UPS ) {
+            if( e.count_by_charges() ) {
+                qty = sum_no_wrap( qty, e.charges );
+            } else {
+                qty = sum_no_wrap( qty, e.ammo_remaining() );
             }
+            if( e.has_flag( STATIC( flag_id( "USE_UPS" ) ) ) ) {
+                found_tool_with_UPS = true;
+            } else if( e.has_flag( STATIC( flag_id( "USES_BIONIC_POWER" ) ) ) ) {
+                found_bionic_tool = true;
+            }
+        } else if( id == itype_UPS && e.has_flag( flag_IS_UPS ) ) {
+            qty = sum_no_wrap( qty, e.ammo_remaining() );
         }
-        if( qty >= limit ) {
-            return VisitResponse::ABORT;
-        }
-        // recurse through nested containers if any
-        return e->is_container() ? VisitResponse::NEXT : VisitResponse::SKIP;
-    } );
+    }
+}
 
+// Adds the power available to the tools that count_charges() found
+template <typename M>
+static int add_tool_power( const M &main, int qty, int limit, bool found_tool_with_UPS,
+                           bool found_bionic_tool, const std::function<void( int )> &visitor )
+{
     if( found_tool_with_UPS && qty < limit && get_player_character().has_active_bionic( bio_ups ) ) {
         qty = sum_no_wrap( qty, static_cast<int>( units::to_kilojoule(
                                get_player_character().get_power_level() ) ) );
@@ -845,6 +852,27 @@ static int charges_of_internal( const T &self, const M &main, const itype_id &id
     return std::min( qty, limit );
 }
 
+template <typename T, typename M>
+static int charges_of_internal( const T &self, const M &main, const itype_id &id, int limit,
+                                const std::function<bool( const item & )> &filter,
+                                const std::function<void( int )> &visitor, bool in_tools )
+{
+    int qty = 0;
+
+    bool found_tool_with_UPS = false;
+    bool found_bionic_tool = false;
+    self.visit_items( [&]( const item * e, item * ) {
+        count_charges( *e, id, filter, in_tools, qty, found_tool_with_UPS, found_bionic_tool );
+        if( qty >= limit ) {
+            return VisitResponse::ABORT;
+        }
+        // recurse through nested containers if any
+        return e->is_container() ? VisitResponse::NEXT : VisitResponse::SKIP;
+    } );
+
+    return add_tool_power( main, qty, limit, found_tool_with_UPS, found_bionic_tool, visitor );
+}
+
 template <typename T>
 static std::pair<int, int> kcal_range_of_internal( const T &self, const itype_id &id,
         const std::function<bool( const item & )> &filter, Character &player_character )
@@ -928,6 +956,13 @@ int Character::charges_of( const itype_id &what, int limit,
         }
         return std::min( ups_power, limit );
     }
+    if( const item_index *index = get_item_index() ) {
+        bool found_tool_with_UPS = false;
+        bool found_bionic_tool = false;
+        const int qty = index->charges_of( what, limit, filter, in_tools, found_tool_with_UPS,
+                                           found_bionic_tool );
+        return add_tool_power( *this, qty, limit, found_tool_with_UPS, found_bionic_tool, visitor );
+    }
     return charges_of_internal( *this, *this, what, limit, filter, visitor, in_tools );
 }
 
@@ -1003,6 +1038,9 @@ int Character::amount_of( const itype_id &what, bool pseudo, int limit,
         return std::min( qty, limit );
     }
 
+    if( const item_index *index = get_item_index() ) {
+        return index->amount_of( what, pseudo, limit, filter );
+    }
     return amount_of_internal( *this, what, pseudo, limit, filter );
 }
 
@@ -1012,3 +1050,99 @@ bool read_only_visitable::has_amount( const itype_id &what, int qty, bool pseudo
 {
     return amount_of( what, pseudo, qty, filter ) == qty;
 }
+
+item_index::item_index( const Character &who )
+{
+    // Items charges_of() looks at, see charges_of_internal()
+    std::unordered_set<const item *> charge_visible;
+    who.visit_items( [&]( const item * e, const item * parent ) {
+        items.push_back( e );
+        by_type[e->typeId()].push_back( e );
+        if( parent == nullptr || ( parent->is_container() && charge_visible.count( parent ) ) ) {
+            charge_visible.insert( e );
+            charges_by_type[e->typeId()].push_back( e );
+            const itype_id ammo = e->ammo_current();
+            if( !ammo.is_null() && ammo != e->typeId() ) {
+                charges_by_ammo[ammo].push_back( e );
+            }
+        }
+        return VisitResponse::NEXT;
+    } );
+}
+
+int item_index::amount_of( const itype_id &what, bool pseudo, int limit,
+                           const std::function<bool( const item & )> &filter ) const
+{
+    const std::vector<const item *> *candidates = &items;
+    if( what != STATIC( itype_id( "any" ) ) ) {
+        const auto iter = by_type.find( what );
+        if( iter == by_type.end() ) {
+            return 0;
+        }
+        candidates = &iter->second;
+    }
+    int qty = 0;
+    for( const item *e : *candidates ) {
+        if( !e->has_flag( STATIC( flag_id( "ITEM_BROKEN" ) ) ) && filter( *e ) &&
+            ( pseudo || !e->has_flag( STATIC( flag_id( "PSEUDO" ) ) ) ) ) {
+            qty = sum_no_wrap( qty, 1 );
+            if( qty == limit ) {
+                break;
+            }
+        }
+    }
+    return qty;
+}
+
+int item_index::charges_of( const itype_id &what, int limit,
+                            const std::function<bool( const item & )> &filter, bool in_tools,
+                            bool &found_tool_with_UPS, bool &found_bionic_tool ) const
+{
+    int qty = 0;
+    const auto count = [&]( const std::unordered_map<itype_id, std::vector<const item *>> &bins ) {
+        const auto iter = bins.find( what );
+        if( iter == bins.end() ) {
+            return;
+        }
+        for( const item *e : iter->second ) {
+            count_charges( *e, what, filter, in_tools, qty, found_tool_with_UPS,
+                           found_bionic_tool );
+            if( qty >= limit ) {
+                return;
+            }
+        }
+    };
+    count( charges_by_type );
+    if( in_tools && qty < limit ) {
+        count( charges_by_ammo );
+    }
+    return qty;
+}
+
+int item_index::has_quality( const quality_id &qual, int level, int limit ) const
+{
+    int qty = 0;
+    for( const item *e : items ) {
+        if( e->get_quality( qual ) >= level ) {
+            qty = sum_no_wrap( qty, static_cast<int>( e->count() ) );
+            if( qty >= limit ) {
+                break;
+            }
+        }
+    }
+    return std::min( qty, limit );
+}
+
+int item_index::max_quality( const quality_id &qual ) const
+{
+    const auto iter = max_qualities.find( qual );
+    if( iter != max_qualities.end() ) {
+        return iter->second;
+    }
+    int res = INT_MIN;
+    for( const item *e : items ) {
+        res = std::max( res, e->get_quality( qual ) );
+    }
+    max_qualities.emplace( qual, res );
+    return res;
+}
@@ -968,10 +968,13 @@ units::temperature weather_manager::get_temperature( const tripoint &location )
     units::temperature temp = location.z < 0 ? AVERAGE_ANNUAL_TEMPERATURE : temperature;
 
     if( !g->new_game ) {
+        map &here = get_map();
         units::temperature_delta temp_mod;
-        temp_mod = get_heat_radiation( location );
+        // The player's own tile still does the exact scan, which checks for a clear path.
+        temp_mod = location == get_player_character().pos() ? get_heat_radiation( location ) :
+                   here.heat_radiation_at( location );
         temp_mod += get_convection_temperature( location );
-        temp_mod += get_map().get_temperature_mod( location );
+        temp_mod += here.get_temperature_mod( location );
 
         temp += temp_mod;
     }
@@ -988,6 +991,7 @@ units::temperature weather_manager::get_temperature( const tripoint_abs_omt &loc
 void weather_manager::clear_temp_cache()
 {
     temperature_cache.clear();
+    get_map().invalidate_heat_radiation_cache();
 }
 
 const weather_manager &get_weather_const()
@@ -27,6 +27,7 @@
 #include "output.h"
 #include "path_info.h"
 #include "point.h"
+#include "save_writer.h"
 #include "sounds.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
@@ -2087,6 +2088,8 @@ void worldfactory::delete_world( const std::string &worldname, const bool delete
     std::string worldpath = get_world( worldname )->folder_path();
     std::set<std::string> directory_paths;
 
+    save_writer::flush();
+
     auto file_paths = get_files_from_path( "", worldpath, true, true );
     if( !delete_folder ) {
         std::vector<std::string>::iterator forbidden = find_if( file_paths.begin(), file_paths.end(),
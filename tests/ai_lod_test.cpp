@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "ai_lod.h"
+#include "avatar.h"
+#include "bodypart.h"
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "game_constants.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "monster.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "rng.h"
+#include "type_id.h"
+
+// Roughly what monmove() in do_turn.cpp does for a monster each turn
+static bool simulate_turn( monster &critter, const std::vector<tripoint> &watchers,
+                           const int max_interval )
+{
+    critter.moves += critter.get_speed();
+    if( !ai_lod::should_act( critter, watchers, max_interval ) ) {
+        return false;
+    }
+    while( critter.moves > 0 && !critter.is_dead() ) {
+        critter.plan();
+        critter.move();
+    }
+    return true;
+}
+
+static monster &spawn_distant_idle_zombie( const std::vector<tripoint> &watchers )
+{
+    monster &zombie = spawn_test_monster( "mon_zombie", tripoint( 10, 10, 0 ) );
+    // Nothing to target for a while makes it idle
+    for( int i = 0; i < ai_lod::idle_turns + 2; i++ ) {
+        simulate_turn( zombie, watchers, 1 );
+    }
+    return zombie;
+}
+
+TEST_CASE( "ai_lod_interval_grows_with_distance", "[monster][ai_lod]" )
+{
+    CHECK( ai_lod::interval( 10, 40, 8 ) == 1 );
+    CHECK( ai_lod::interval( 40 + 2 * SEEX, 40, 8 ) == 1 );
+    CHECK( ai_lod::interval( 40 + 2 * SEEX + 1, 40, 8 ) == 2 );
+    CHECK( ai_lod::interval( 1000, 40, 8 ) == 8 );
+    CHECK( ai_lod::interval( 1000, 40, 1 ) == 1 );
+}
+
+TEST_CASE( "ai_lod_banks_moves_of_distant_idle_monsters", "[monster][ai_lod]" )
+{
+    clear_map();
+    clear_avatar();
+    get_avatar().setpos( tripoint( 120, 120, 0 ) );
+    const std::vector<tripoint> watchers = { get_avatar().pos() };
+    monster &zombie = spawn_distant_idle_zombie( watchers );
+
+    int acted = 0;
+    for( int i = 0; i < 24; i++ ) {
+        const int moves_before = zombie.moves;
+        if( simulate_turn( zombie, watchers, 8 ) ) {
+            acted++;
+            CHECK( zombie.moves <= 0 );
+        } else {
+            CHECK( zombie.moves == moves_before + zombie.get_speed() );
+            CHECK( zombie.moves <= 8 * zombie.get_speed() );
+        }
+    }
+    CHECK( acted > 0 );
+    CHECK( acted < 24 );
+
+    SECTION( "being hurt makes it act right away" ) {
+        bool skipped = false;
+        for( int i = 0; i < 8 && !skipped; i++ ) {
+            skipped = !simulate_turn( zombie, watchers, 8 );
+        }
+        REQUIRE( skipped );
+        zombie.apply_damage( nullptr, body_part_torso, 1 );
+        CHECK( simulate_turn( zombie, watchers, 8 ) );
+    }
+
+    SECTION( "monsters close to a watcher act every turn" ) {
+        const std::vector<tripoint> near_watchers = { zombie.pos() + point( 5, 5 ) };
+        for( int i = 0; i < 5; i++ ) {
+            CHECK( simulate_turn( zombie, near_watchers, 8 ) );
+        }
+    }
+}
+
+// Positions turn by turn of a zombie patrolling from (10, 10) to (20, 10) and back, far from the
+// watchers, acting at most max_interval turns apart
+static std::vector<tripoint> patrol( const int max_interval )
+{
+    clear_map();
+    clear_avatar();
+    get_avatar().setpos( tripoint( 120, 120, 0 ) );
+    const std::vector<tripoint> watchers = { get_avatar().pos() };
+    rng_set_engine_seed( 1234 );
+    monster &zombie = spawn_test_monster( "mon_zombie", tripoint( 10, 10, 0 ) );
+    const point start = ( get_map().getglobal( zombie.pos() ) -
+                          project_to<coords::ms>( zombie.global_omt_location() ) ).raw().xy();
+    zombie.set_patrol_route( { start, start + point( 10, 0 ) } );
+    for( int i = 0; i < ai_lod::idle_turns + 2; i++ ) {
+        simulate_turn( zombie, watchers, 1 );
+    }
+
+    std::vector<tripoint> positions;
+    for( int i = 0; i < 80; i++ ) {
+        if( !simulate_turn( zombie, watchers, max_interval ) ) {
+            CHECK( zombie.moves <= max_interval * zombie.get_speed() );
+        }
+        positions.push_back( zombie.pos() );
+    }
+    return positions;
+}
+
+TEST_CASE( "ai_lod_keeps_patrolling_monsters_on_their_route", "[monster][ai_lod]" )
+{
+    const std::vector<tripoint> every_turn = patrol( 1 );
+    const std::vector<tripoint> skipping = patrol( 4 );
+    CHECK( patrol( 4 ) == skipping );
+
+    for( const std::vector<tripoint> *positions : {
+             &every_turn, &skipping
+         } ) {
+        // Banked moves do not carry it past the ends of the route
+        for( const tripoint &p : *positions ) {
+            CAPTURE( p );
+            CHECK( p.x >= 8 );
+            CHECK( p.x <= 22 );
+            CHECK( std::abs( p.y - 10 ) <= 2 );
+            CHECK( p.z == 0 );
+        }
+        // And it covers about as much ground as acting every turn, there and back
+        const auto far_end = std::find_if( positions->begin(), positions->end(),
+        []( const tripoint & p ) {
+            return p.x >= 19;
+        } );
+        REQUIRE( far_end != positions->end() );
+        CHECK( std::any_of( far_end, positions->end(), []( const tripoint & p ) {
+            return p.x <= 12;
+        } ) );
+    }
+}
+
+TEST_CASE( "ai_lod_throughput_benchmark", "[.][monster][ai_lod][benchmark]" )
+{
+    clear_map();
+    clear_avatar();
+    get_avatar().setpos( tripoint( 120, 120, 0 ) );
+    const std::vector<tripoint> watchers = { get_avatar().pos() };
+    std::vector<monster *> zombies;
+    for( int x = 2; x < 60; x += 3 ) {
+        for( int y = 2; y < 60; y += 3 ) {
+            zombies.push_back( &spawn_test_monster( "mon_zombie", tripoint( x, y, 0 ) ) );
+        }
+    }
+    const auto turn = [&]( const int max_interval ) {
+        for( monster *zombie : zombies ) {
+            simulate_turn( *zombie, watchers, max_interval );
+        }
+    };
+    for( int i = 0; i < ai_lod::idle_turns + 2; i++ ) {
+        turn( 1 );
+    }
+
+    BENCHMARK( "every monster every turn" ) {
+        turn( 1 );
+    };
+    BENCHMARK( "level of detail, interval up to 8" ) {
+        turn( 8 );
+    };
+}
@@ -190,6 +190,40 @@ TEST_CASE( "recipe_subset" )
     }
 }
 
+TEST_CASE( "recipe_subset_search_matches_every_recipe_it_should", "[recipes]" )
+{
+    recipe_subset all;
+    for( const auto &e : recipe_dict ) {
+        all.include( &e.second );
+    }
+    using search_type = recipe_subset::search_type;
+    for( const std::string query : {
+             "rum", "HAMMER", "ste", "ing ", "xyzzy", "wa"
+         } ) {
+        CAPTURE( query );
+        std::vector<const recipe *> names;
+        std::vector<const recipe *> other_names;
+        std::vector<const recipe *> components;
+        for( const recipe *r : all ) {
+            if( !*r || r->obsolete ) {
+                continue;
+            }
+            ( lcmatch( r->result_name(), query ) ? names : other_names ).push_back( r );
+            for( const std::vector<item_comp> &opts : r->simple_requirements().get_components() ) {
+                if( std::any_of( opts.begin(), opts.end(), [&]( const item_comp & ic ) {
+                return lcmatch( item::nname( ic.type ), query );
+                } ) ) {
+                    components.push_back( r );
+                    break;
+                }
+            }
+        }
+        CHECK( all.search( query, search_type::name ) == names );
+        CHECK( all.search( query, search_type::exclude_name ) == other_names );
+        CHECK( all.search( query, search_type::component ) == components );
+    }
+}
+
 TEST_CASE( "available_recipes", "[recipes]" )
 {
     const recipe *r = &recipe_magazine_battery_light_mod.obj();
@@ -960,6 +994,41 @@ TEST_CASE( "tool_use", "[crafting][tool]" )
     }
 }
 
+TEST_CASE( "requirement_check_cache_gives_the_same_answers", "[crafting][requirements]" )
+{
+    inventory inv;
+    inv.add_item( item( itype_hammer ) );
+    inv.add_item( item( itype_pockknife ) );
+    inv.add_item( item( itype_sewing_kit ) );
+    inv.add_item( item( itype_sheet_cotton ) );
+    inv.add_item( item( itype_sheet_cotton ) );
+    inv.add_item( item( itype_thread, calendar::turn_zero, 50 ) );
+
+    std::vector<std::pair<const requirement_data *, int>> checks;
+    for( const std::pair<const recipe_id, recipe> &rec : recipe_dict ) {
+        for( const requirement_data &req : rec.second.deduped_requirements().alternatives() ) {
+            checks.emplace_back( &req, 1 );
+            checks.emplace_back( &req, 4 );
+        }
+    }
+    std::vector<bool> expected;
+    for( const std::pair<const requirement_data *, int> &check : checks ) {
+        expected.push_back( check.first->can_make_with_inventory( inv, return_true<item>,
+                            check.second ) );
+    }
+    REQUIRE( std::find( expected.begin(), expected.end(), true ) != expected.end() );
+
+    requirement_check_cache cache( inv );
+    // Twice, to get answers both from the inventory and from the cache
+    for( int pass = 0; pass < 2; pass++ ) {
+        for( size_t i = 0; i < checks.size(); i++ ) {
+            CAPTURE( pass, i );
+            CHECK( checks[i].first->can_make_with_inventory( inv, return_true<item>,
+                    checks[i].second ) == expected[i] );
+        }
+    }
+}
+
 TEST_CASE( "broken_component", "[crafting][component]" )
 {
     GIVEN( "a recipe with its required components" ) {
@@ -0,0 +1,68 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cata_catch.h"
+#include "flat_map.h"
+
+TEST_CASE( "flat_map", "[flat_map]" )
+{
+    cata::flat_map<int, std::string> m;
+    m[2] = "two";
+    m[1] = "one";
+    CHECK( m.insert( { 4, "four" } ).second );
+    CHECK_FALSE( m.insert( { 4, "FOUR" } ).second );
+    CHECK( m.try_emplace( 3, "three" ).second );
+
+    using entries = std::vector<std::pair<int, std::string>>;
+    entries ref{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" } };
+    CHECK( entries( m.begin(), m.end() ) == ref );
+    CHECK( m.size() == 4 );
+    CHECK( m.count( 0 ) == 0 );
+    CHECK( m.count( 1 ) == 1 );
+    CHECK( m.count( 5 ) == 0 );
+    CHECK( m.find( 0 ) == m.end() );
+    CHECK( m.find( 1 ) == m.begin() );
+    CHECK( m.find( 3 ) == m.begin() + 2 );
+
+    m[3] = "drei";
+    CHECK( m.find( 3 )->second == "drei" );
+
+    CHECK( m.erase( 2 ) == 1 );
+    CHECK( m.erase( 2 ) == 0 );
+    CHECK( m.size() == 3 );
+    CHECK( m.find( 2 ) == m.end() );
+}
+
+TEST_CASE( "flat_map_ranged_operations", "[flat_map]" )
+{
+    // Of duplicate keys the first one wins, like inserting into a std::map one by one.
+    std::vector<std::pair<int, int>> in{ { 4, 40 }, { 0, 0 }, { 2, 20 }, { 0, 1 } };
+    cata::flat_map<int, int> m( in.begin(), in.end() );
+    std::vector<std::pair<int, int>> ref{ { 0, 0 }, { 2, 20 }, { 4, 40 } };
+    CHECK( std::vector<std::pair<int, int>>( m.begin(), m.end() ) == ref );
+
+    m.erase( m.lower_bound( 1 ), m.lower_bound( 4 ) );
+    std::vector<std::pair<int, int>> ref2{ { 0, 0 }, { 4, 40 } };
+    CHECK( std::vector<std::pair<int, int>>( m.begin(), m.end() ) == ref2 );
+}
+
+TEST_CASE( "flat_map_transparent_lookup", "[flat_map]" )
+{
+    cata::flat_map<std::string, int> m{ { "b", 2 }, { "a", 1 } };
+    CHECK( m.begin()->first == "a" );
+    CHECK( m.count( "a" ) == 1 );
+    CHECK( m.count( "c" ) == 0 );
+    CHECK( m.find( "b" )->second == 2 );
+    CHECK( m.find( "c" ) == m.end() );
+}
+
+TEST_CASE( "flat_map_comparison", "[flat_map]" )
+{
+    using int_map = cata::flat_map<int, int>;
+    // NOLINTNEXTLINE(readability-container-size-empty)
+    CHECK( int_map{} == int_map{} );
+    CHECK( int_map{ { 0, 1 } } == int_map{ { 0, 1 } } );
+    CHECK( int_map{ { 0, 1 } } != int_map{ { 0, 2 } } );
+    CHECK( int_map{ { 0, 1 } } < int_map{ { 1, 0 } } );
+}
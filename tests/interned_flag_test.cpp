@@ -0,0 +1,161 @@
+#include <cstddef>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cata_catch.h"
+#include "interned_flag.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
+#include "point.h"
+#include "type_id.h"
+#include "veh_type.h"
+
+static const furn_str_id furn_f_home_furnace( "f_home_furnace" );
+static const furn_str_id furn_f_scrap_bridge( "f_scrap_bridge" );
+
+static std::vector<const ter_t *> all_terrain()
+{
+    std::vector<const ter_t *> result;
+    for( size_t i = 0; i < ter_t::count(); i++ ) {
+        result.push_back( &ter_id( static_cast<int>( i ) ).obj() );
+    }
+    return result;
+}
+
+static std::vector<const furn_t *> all_furniture()
+{
+    std::vector<const furn_t *> result;
+    for( size_t i = 0; i < furn_t::count(); i++ ) {
+        result.push_back( &furn_id( static_cast<int>( i ) ).obj() );
+    }
+    return result;
+}
+
+TEST_CASE( "interned_flags_keep_their_index", "[flag]" )
+{
+    const interned_flag a( "INTERNED_FLAG_TEST_A" );
+    const interned_flag b( "INTERNED_FLAG_TEST_B" );
+    CHECK( a.index() != b.index() );
+    CHECK( interned_flag( "INTERNED_FLAG_TEST_A" ).index() == a.index() );
+    CHECK( a.str() == "INTERNED_FLAG_TEST_A" );
+
+    interned_flag_set flags;
+    CHECK_FALSE( flags.has( a ) );
+    flags.set( a );
+    CHECK( flags.has( a ) );
+    CHECK_FALSE( flags.has( b ) );
+    flags.assign( { "INTERNED_FLAG_TEST_B" } );
+    CHECK_FALSE( flags.has( a ) );
+    CHECK( flags.has( b ) );
+    CHECK_FALSE( flags.has( interned_flag( "INTERNED_FLAG_TEST_C" ) ) );
+}
+
+TEST_CASE( "interned_flags_match_the_string_flags", "[flag][map][vehicle]" )
+{
+    std::set<std::string> all_flags = { "INTERNED_FLAG_TEST_UNUSED" };
+    for( const ter_t *ter : all_terrain() ) {
+        all_flags.insert( ter->get_flags().begin(), ter->get_flags().end() );
+    }
+    for( const furn_t *furn : all_furniture() ) {
+        all_flags.insert( furn->get_flags().begin(), furn->get_flags().end() );
+    }
+    for( const vpart_info &vpi : vehicles::parts::get_all() ) {
+        all_flags.insert( vpi.get_flags().begin(), vpi.get_flags().end() );
+    }
+
+    for( const std::string &flag_str : all_flags ) {
+        CAPTURE( flag_str );
+        const interned_flag flag( flag_str );
+        for( const ter_t *ter : all_terrain() ) {
+            CAPTURE( ter->id.str() );
+            CHECK( ter->has_flag( flag ) == ter->has_flag( flag_str ) );
+        }
+        for( const furn_t *furn : all_furniture() ) {
+            CAPTURE( furn->id.str() );
+            CHECK( furn->has_flag( flag ) == furn->has_flag( flag_str ) );
+        }
+        for( const vpart_info &vpi : vehicles::parts::get_all() ) {
+            CAPTURE( vpi.id.str() );
+            CHECK( vpi.has_flag( flag ) == vpi.has_flag( flag_str ) );
+        }
+    }
+}
+
+TEST_CASE( "map_checks_furniture_flags_through_interned_handles", "[flag][map]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint bridge( 10, 10, 0 );
+    const tripoint furnace( 12, 10, 0 );
+    const tripoint empty( 14, 10, 0 );
+    REQUIRE( here.furn_set( bridge, furn_f_scrap_bridge ) );
+    REQUIRE( here.furn_set( furnace, furn_f_home_furnace ) );
+
+    for( const std::string flag_str : {
+             "BRIDGE", "FIRE_CONTAINER"
+         } ) {
+        CAPTURE( flag_str );
+        const interned_flag flag( flag_str );
+        for( const tripoint &p : {
+                 bridge, furnace, empty
+             } ) {
+            CAPTURE( p );
+            CHECK( here.has_flag_furn( flag, p ) == here.has_flag_furn( flag_str, p ) );
+        }
+    }
+    CHECK( here.has_flag_furn( interned_flag( "BRIDGE" ), bridge ) );
+    CHECK( here.has_flag_furn( interned_flag( "FIRE_CONTAINER" ), furnace ) );
+    CHECK_FALSE( here.has_flag_furn( interned_flag( "BRIDGE" ), furnace ) );
+    CHECK_FALSE( here.has_flag_furn( interned_flag( "FIRE_CONTAINER" ), empty ) );
+}
+
+TEST_CASE( "flag_check_benchmark", "[.][flag][benchmark]" )
+{
+    const std::vector<const ter_t *> terrain = all_terrain();
+    std::vector<const vpart_info *> parts;
+    for( const vpart_info &vpi : vehicles::parts::get_all() ) {
+        parts.push_back( &vpi );
+    }
+    const std::string str_FLAMMABLE( "FLAMMABLE" );
+    const std::string str_POWER_TRANSFER( "POWER_TRANSFER" );
+    const interned_flag flag_FLAMMABLE( str_FLAMMABLE );
+    const interned_flag flag_POWER_TRANSFER( str_POWER_TRANSFER );
+
+    BENCHMARK( "terrain, string flag" ) {
+        int found = 0;
+        for( const ter_t *ter : terrain ) {
+            found += ter->has_flag( str_FLAMMABLE );
+        }
+        return found;
+    };
+    BENCHMARK( "terrain, interned flag" ) {
+        int found = 0;
+        for( const ter_t *ter : terrain ) {
+            found += ter->has_flag( flag_FLAMMABLE );
+        }
+        return found;
+    };
+    BENCHMARK( "terrain, enum flag" ) {
+        int found = 0;
+        for( const ter_t *ter : terrain ) {
+            found += ter->has_flag( ter_furn_flag::TFLAG_FLAMMABLE );
+        }
+        return found;
+    };
+    BENCHMARK( "vehicle parts, string flag" ) {
+        int found = 0;
+        for( const vpart_info *vpi : parts ) {
+            found += vpi->has_flag( str_POWER_TRANSFER );
+        }
+        return found;
+    };
+    BENCHMARK( "vehicle parts, interned flag" ) {
+        int found = 0;
+        for( const vpart_info *vpi : parts ) {
+            found += vpi->has_flag( flag_POWER_TRANSFER );
+        }
+        return found;
+    };
+}
@@ -5,6 +5,8 @@
 #include <initializer_list>
 #include <limits>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "avatar.h"
@@ -17,6 +19,8 @@
 #include "item_factory.h"
 #include "item_pocket.h"
 #include "itype.h"
+#include "json.h"
+#include "json_loader.h"
 #include "math_defines.h"
 #include "monstergenerator.h"
 #include "mtype.h"
@@ -38,6 +42,7 @@ static const item_category_id item_category_food( "food" );
 static const itype_id itype_test_backpack( "test_backpack" );
 static const itype_id itype_test_duffelbag( "test_duffelbag" );
 static const itype_id itype_test_mp3( "test_mp3" );
+static const itype_id itype_test_rock( "test_rock" );
 static const itype_id itype_test_smart_phone( "test_smart_phone" );
 static const itype_id itype_test_waterproof_bag( "test_waterproof_bag" );
 
@@ -322,6 +327,39 @@ TEST_CASE( "item_variables_round-trip_accurately", "[item]" )
     CHECK( i.get_var( "C", tripoint() ) == tripoint( 2, 3, 4 ) );
 }
 
+TEST_CASE( "item_copy_and_load_benchmark", "[.][item][benchmark]" )
+{
+    // A large base: backpacks full of items which carry both flags and variables,
+    // which used to cost a heap allocation per flag and per variable.
+    std::vector<item> base;
+    for( int i = 0; i < 200; ++i ) {
+        item pack( itype_test_backpack );
+        for( int j = 0; j < 10; ++j ) {
+            item rock( itype_test_rock );
+            rock.set_flag( json_flag_FILTHY );
+            rock.set_flag( json_flag_COLD );
+            rock.set_var( "item_note", "stash " + std::to_string( i ) );
+            rock.set_var( "spawn_location_omt", tripoint( i, j, 0 ) );
+            REQUIRE( pack.put_in( rock, item_pocket::pocket_type::CONTAINER ).success() );
+        }
+        base.push_back( pack );
+    }
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.write( base );
+    const std::string saved = os.str();
+
+    BENCHMARK( "copy" ) {
+        return std::vector<item>( base ).size();
+    };
+    BENCHMARK( "load" ) {
+        std::vector<item> loaded;
+        json_loader::from_string( saved ).read( loaded );
+        return loaded.size();
+    };
+}
+
 TEST_CASE( "water_affect_items_while_swimming_check", "[item][water][swimming]" )
 {
     avatar &guy = get_avatar();
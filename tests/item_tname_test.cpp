@@ -612,3 +612,34 @@ TEST_CASE( "nested_items_tname", "[item][tname]" )
         CHECK( usb_drive.tname( 1 ) == "USB drive " + nesting_sym + " " + medisoft_nested_tname );
     }
 }
+
+TEST_CASE( "display_cache_keeps_names_until_items_change", "[item][tname]" )
+{
+    item backpack_hiking( itype_backpack_hiking );
+    item rock( itype_test_rock );
+    item gun( "hk_mp5" );
+    const std::string empty_backpack_name = backpack_hiking.tname();
+    const std::string gun_name = gun.tname();
+    const std::string gun_info = gun.info( true );
+
+    item::display_cache_scope scope;
+    CHECK( backpack_hiking.tname() == empty_backpack_name );
+    CHECK( backpack_hiking.tname() == empty_backpack_name );
+    CHECK( gun.info( true ) == gun_info );
+
+    SECTION( "changes to contents and favorites are seen" ) {
+        backpack_hiking.put_in( rock, item_pocket::pocket_type::CONTAINER );
+        const std::string full_backpack_name = backpack_hiking.tname();
+        CHECK( full_backpack_name != empty_backpack_name );
+        backpack_hiking.set_favorite( true );
+        CHECK( backpack_hiking.tname() != full_backpack_name );
+    }
+
+    SECTION( "other changes need the cache to be invalidated" ) {
+        gun.faults.insert( fault_gun_dirt );
+        gun.set_var( "dirt", 10000 );
+        CHECK( gun.tname() == gun_name );
+        item::invalidate_display_cache();
+        CHECK( gun.tname() != gun_name );
+    }
+}
@@ -20,11 +20,13 @@
 #include "damage.h"
 #include "debug.h"
 #include "enum_bitset.h"
+#include "filesystem.h"
 #include "item.h"
 #include "json.h"
 #include "json_loader.h"
 #include "magic.h"
 #include "mutation.h"
+#include "path_info.h"
 #include "sounds.h"
 #include "string_formatter.h"
 #include "translations.h"
@@ -876,3 +878,35 @@ TEST_CASE( "serialize_optional", "[json]" )
         test_serialization( v, "[1,2,3]" );
     }
 }
+
+// Files are parsed straight from their mapping unless they fill their last page, see
+// flexbuffer_cache.cpp, so check sizes on both sides of a page boundary.
+TEST_CASE( "json_files_load_whatever_their_size", "[json]" )
+{
+    const cata_path path = PATH_INFO::user_dir_path() / "json_size_test.json";
+    for( const size_t size : {
+             4095, 4096, 4097, 8192
+         } ) {
+        CAPTURE( size );
+        std::string text = R"({"ids":[)";
+        for( int i = 0; i < 100; i++ ) {
+            text += R"("t_dirt",)";
+        }
+        text += R"("t_dirt"],"pad":")";
+        const size_t pad = size - text.size() - 2;
+        text += std::string( pad, 'x' ) + R"("})";
+        REQUIRE( text.size() == size );
+        write_to_file( path, [&]( std::ostream & fout ) {
+            fout << text;
+        } );
+
+        JsonObject jo = json_loader::from_path( path ).get_object();
+        const std::vector<std::string> ids = jo.get_string_array( "ids" );
+        CHECK( ids.size() == 101 );
+        CHECK( std::all_of( ids.begin(), ids.end(), []( const std::string & id ) {
+            return id == "t_dirt";
+        } ) );
+        CHECK( jo.get_string( "pad" ) == std::string( pad, 'x' ) );
+    }
+    CHECK( remove_file( path.get_unrelative_path() ) );
+}
@@ -1,6 +1,7 @@
 #include <bitset>
 #include <cstdio>
 #include <sstream>
+#include <string>
 #include <type_traits>
 
 #include "cata_catch.h"
@@ -9,6 +10,7 @@
 #include "lru_cache.h"
 #include "map.h"
 #include "map_memory.h"
+#include "memory_fast.h"
 #include "point.h"
 
 static constexpr tripoint p1{ -SEEX - 2, -SEEY - 3, -1 };
@@ -122,7 +124,95 @@ TEST_CASE( "map_memory_forgets", "[map_memory]" )
     CHECK( mt.get_dec_rotation() == 0 );
 }
 
-// TODO: map memory save / load
+static memorized_tile make_region_test_tile( int sm_idx, int i )
+{
+    memorized_tile tile;
+    tile.symbol = i % 5 == 0 ? 0x1F600 + sm_idx : U'#';
+    tile.set_ter_id( "t_region_test_" + std::to_string( ( sm_idx + i / 20 ) % 7 ) );
+    tile.set_ter_subtile( i / 36 );
+    tile.set_ter_rotation( i / 48 );
+    if( i % 3 == 0 ) {
+        tile.set_dec_id( "vp_a_fairly_long_vehicle_part_id_for_the_region_test_" +
+                         std::to_string( sm_idx ) );
+        // Values outside of 0..15 don't fit the packed form
+        tile.set_dec_subtile( i == 9 ? 40 : 2 );
+        tile.set_dec_rotation( i == 9 ? -1 : 3 );
+    }
+    return tile;
+}
+
+TEST_CASE( "map_memory_region_binary_round_trip", "[map_memory]" )
+{
+    mm_region region;
+    int sm_idx = 0;
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            region.submaps[x][y] = make_shared_fast<mm_submap>();
+            // Leave some submaps empty
+            if( sm_idx++ % 3 == 0 ) {
+                continue;
+            }
+            for( int i = 0; i < SEEX * SEEY; i++ ) {
+                region.submaps[x][y]->set_tile( point( i % SEEX, i / SEEX ),
+                                                make_region_test_tile( sm_idx, i ) );
+            }
+        }
+    }
+
+    std::stringstream buffer;
+    region.serialize_binary( buffer );
+    mm_region loaded;
+    loaded.deserialize_binary( buffer );
+
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            CAPTURE( x, y );
+            const mm_submap &expected = *region.submaps[x][y];
+            const mm_submap &actual = *loaded.submaps[x][y];
+            CHECK( expected.is_empty() == actual.is_empty() );
+            for( int i = 0; i < SEEX * SEEY; i++ ) {
+                const point p( i % SEEX, i / SEEX );
+                CAPTURE( p );
+                const memorized_tile &e = expected.get_tile( p );
+                const memorized_tile &a = actual.get_tile( p );
+                CHECK( e.symbol == a.symbol );
+                CHECK( e.get_ter_id() == a.get_ter_id() );
+                CHECK( e.get_ter_subtile() == a.get_ter_subtile() );
+                CHECK( e.get_ter_rotation() == a.get_ter_rotation() );
+                CHECK( e.get_dec_id() == a.get_dec_id() );
+                CHECK( e.get_dec_subtile() == a.get_dec_subtile() );
+                CHECK( e.get_dec_rotation() == a.get_dec_rotation() );
+            }
+        }
+    }
+
+    // Way smaller than the json it replaces
+    std::ostringstream json;
+    JsonOut jsout( json );
+    region.serialize( jsout );
+    CHECK( buffer.str().size() * 2 < json.str().size() );
+}
+
+TEST_CASE( "map_memory_region_rejects_bad_data", "[map_memory]" )
+{
+    mm_region region;
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            region.submaps[x][y] = make_shared_fast<mm_submap>();
+        }
+    }
+    region.submaps[1][2]->set_tile( point_zero, make_region_test_tile( 0, 0 ) );
+    std::stringstream buffer;
+    region.serialize_binary( buffer );
+    const std::string data = buffer.str();
+
+    std::istringstream truncated( data.substr( 0, data.size() - 3 ) );
+    mm_region loaded;
+    CHECK_THROWS( loaded.deserialize_binary( truncated ) );
+
+    std::istringstream not_a_region( "{\"version\": 1, \"data\": []}" );
+    CHECK_THROWS( loaded.deserialize_binary( not_a_region ) );
+}
 
 #include <chrono>
 
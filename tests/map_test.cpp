@@ -1,19 +1,34 @@
 #include "cata_catch.h"
 #include "map.h"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <vector>
 
 #include "avatar.h"
 #include "coordinates.h"
 #include "enums.h"
+#include "field_type.h"
 #include "itype.h"
 #include "game.h"
+#include "line.h"
 #include "game_constants.h"
 #include "map_helpers.h"
+#include "map_iterator.h"
+#include "mapbuffer.h"
+#include "mapdata.h"
+#include "player_helpers.h"
 #include "point.h"
 #include "submap.h"
 #include "type_id.h"
+#include "units.h"
+
+static const furn_str_id furn_f_table( "f_table" );
+
+static const ter_str_id ter_t_floor_waxed( "t_floor_waxed" );
+static const ter_str_id ter_t_open_air( "t_open_air" );
+static const ter_str_id ter_t_wall( "t_wall" );
 
 TEST_CASE( "map_coordinate_conversion_functions" )
 {
@@ -310,3 +325,238 @@ TEST_CASE( "active_monster_drops", "[active_item][map]" )
     }
     CHECK( dropped_bag.empty() );
 }
+
+TEST_CASE( "heat_radiation_field_matches_direct_scan", "[map][temperature]" )
+{
+    map &here = get_map();
+    clear_map();
+    clear_avatar();
+    const tripoint fire_loc( 60, 60, 0 );
+    const tripoint wall_loc = fire_loc + tripoint( 3, 0, 0 );
+    here.add_field( fire_loc, fd_fire, 2 );
+    here.ter_set( wall_loc, ter_t_wall );
+    here.invalidate_heat_radiation_cache();
+    here.build_map_cache( 0 );
+
+    const auto check_field = [&]() {
+        for( const tripoint &p : here.points_in_radius( fire_loc, 8 ) ) {
+            if( p == get_avatar().pos() ) {
+                continue;
+            }
+            CAPTURE( p );
+            CHECK( units::to_fahrenheit_delta( here.heat_radiation_at( p ) ) ==
+                   Approx( units::to_fahrenheit_delta( get_heat_radiation( p ) ) ) );
+        }
+    };
+
+    CHECK( units::to_fahrenheit_delta( here.heat_radiation_at( fire_loc + tripoint_east ) ) > 0 );
+    CHECK( units::to_fahrenheit_delta( here.heat_radiation_at( wall_loc + tripoint_east ) ) == 0 );
+    check_field();
+
+    here.remove_field( fire_loc, fd_fire );
+    here.invalidate_heat_radiation_cache();
+    CHECK( units::to_fahrenheit_delta( here.heat_radiation_at( fire_loc + tripoint_east ) ) == 0 );
+    check_field();
+}
+
+TEST_CASE( "mapbuffer_unloads_least_recently_used_submaps", "[map]" )
+{
+    clear_map();
+    MAPBUFFER.clear_outside_reality_bubble();
+    const size_t bubble_submaps = MAPBUFFER.resident_submaps();
+    const size_t unloaded_before = MAPBUFFER.unloaded_submaps();
+
+    const tripoint_abs_sm far_away( get_map().get_abs_sub() + point( 4 * MAPSIZE, 0 ) );
+    const tripoint marked( 5, 5, 0 );
+    {
+        tinymap m;
+        m.load( far_away, false );
+        m.ter_set( marked, ter_t_wall );
+    }
+    REQUIRE( MAPBUFFER.resident_submaps() > bubble_submaps );
+
+    MAPBUFFER.unload_least_recently_used( bubble_submaps );
+    // Only the reality bubble is left
+    CHECK( MAPBUFFER.resident_submaps() == bubble_submaps );
+    CHECK( MAPBUFFER.unloaded_submaps() > unloaded_before );
+    CHECK( MAPBUFFER.resident_bytes() == bubble_submaps * sizeof( submap ) );
+
+    // The modified submap was written out and comes back from disk
+    tinymap m;
+    m.load( far_away, false );
+    CHECK( m.ter( marked ).id() == ter_t_wall );
+}
+
+TEST_CASE( "unloaded_submaps_are_kept_only_if_the_game_is_saved", "[map]" )
+{
+    clear_map();
+    MAPBUFFER.clear_outside_reality_bubble();
+    const size_t bubble_submaps = MAPBUFFER.resident_submaps();
+    const tripoint_abs_sm far_away( get_map().get_abs_sub() + point( 6 * MAPSIZE, 0 ) );
+    const tripoint marked( 5, 5, 0 );
+    const auto modify_and_unload = [&]() {
+        {
+            tinymap m;
+            m.load( far_away, false );
+            REQUIRE( m.ter( marked ).id() != ter_t_wall );
+            m.ter_set( marked, ter_t_wall );
+        }
+        MAPBUFFER.unload_least_recently_used( bubble_submaps );
+        REQUIRE( MAPBUFFER.resident_submaps() == bubble_submaps );
+    };
+    const auto marked_after_reload = [&]() {
+        MAPBUFFER.clear_outside_reality_bubble();
+        tinymap m;
+        m.load( far_away, false );
+        return m.ter( marked ).id() == ter_t_wall;
+    };
+
+    SECTION( "quitting without saving discards the change" ) {
+        modify_and_unload();
+        MAPBUFFER.discard_unsaved_quads();
+        CHECK_FALSE( marked_after_reload() );
+    }
+    SECTION( "saving keeps the change" ) {
+        modify_and_unload();
+        MAPBUFFER.save();
+        MAPBUFFER.discard_unsaved_quads();
+        CHECK( marked_after_reload() );
+    }
+}
+
+TEST_CASE( "sees_is_reflexive_and_follows_walls", "[map][vision]" )
+{
+    map &here = get_map();
+    clear_map();
+    clear_avatar();
+    const tripoint from( 60, 60, 0 );
+    const tripoint to = from + tripoint( 6, 2, 0 );
+    here.build_map_cache( 0 );
+    CHECK( here.sees( from, to, 20 ) );
+    CHECK( here.sees( to, from, 20 ) );
+    CHECK_FALSE( here.sees( from, to, 3 ) );
+
+    // Remembered results go away with the wall change
+    here.ter_set( from + tripoint( 3, 1, 0 ), ter_t_wall );
+    here.build_map_cache( 0 );
+    CHECK_FALSE( here.sees( from, to, 20 ) );
+    CHECK_FALSE( here.sees( to, from, 20 ) );
+    CHECK( here.sees( from, from + tripoint( 3, 1, 0 ), 20 ) );
+}
+
+TEST_CASE( "map_data_property_tables_match_the_types", "[map]" )
+{
+    const map_data_property_table &ter_props = ter_properties();
+    REQUIRE( ter_props.flags.size() == ter_t::count() );
+    for( size_t i = 0; i < ter_t::count(); i++ ) {
+        const ter_t &ter = ter_id( static_cast<int>( i ) ).obj();
+        CAPTURE( ter.id.str() );
+        CHECK( ter_props.flags[i] == ter.get_flag_bits() );
+        CHECK( ter_props.movecost[i] == ter.movecost );
+        CHECK( static_cast<bool>( ter_props.transparent[i] ) == ter.transparent );
+    }
+    const map_data_property_table &furn_props = furn_properties();
+    REQUIRE( furn_props.flags.size() == furn_t::count() );
+    for( size_t i = 0; i < furn_t::count(); i++ ) {
+        const furn_t &furn = furn_id( static_cast<int>( i ) ).obj();
+        CAPTURE( furn.id.str() );
+        CHECK( furn_props.flags[i] == furn.get_flag_bits() );
+        CHECK( furn_props.movecost[i] == furn.movecost );
+        CHECK( static_cast<bool>( furn_props.transparent[i] ) == furn.transparent );
+    }
+}
+
+static void build_cache_test_map()
+{
+    map &here = get_map();
+    clear_map( -1, 0 );
+    for( int x = 10; x < MAPSIZE_X - 10; x += 7 ) {
+        for( int y = 10; y < MAPSIZE_Y - 10; y += 5 ) {
+            here.ter_set( tripoint( x, y, 0 ), ter_t_wall );
+            here.ter_set( tripoint( x + 2, y, 0 ), ter_t_open_air );
+            here.ter_set( tripoint( x + 3, y + 1, 0 ), ter_t_floor_waxed );
+            here.furn_set( tripoint( x + 4, y + 2, 0 ), furn_f_table );
+        }
+    }
+}
+
+TEST_CASE( "bulk_built_caches_match_the_tiles", "[map]" )
+{
+    map &here = get_map();
+    build_cache_test_map();
+    here.set_floor_cache_dirty( 0 );
+    here.build_floor_cache( 0 );
+    std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> blocks_scent;
+    std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> reduces_scent;
+    here.scent_blockers( blocks_scent, reduces_scent, point_zero,
+                         point( MAPSIZE_X - 1, MAPSIZE_Y - 1 ) );
+
+    const level_cache &cache = here.get_cache_ref( 0 );
+    for( const tripoint &p : here.points_on_zlevel( 0 ) ) {
+        CAPTURE( p );
+        const ter_t &ter = here.ter( p ).obj();
+        const bool no_floor = ter.has_flag( ter_furn_flag::TFLAG_NO_FLOOR ) ||
+                              ter.has_flag( ter_furn_flag::TFLAG_GOES_DOWN ) ||
+                              ter.has_flag( ter_furn_flag::TFLAG_TRANSPARENT_FLOOR );
+        CHECK( cache.floor_cache[p.x][p.y] == !no_floor );
+        const bool blocks = ter.has_flag( ter_furn_flag::TFLAG_NO_SCENT );
+        const bool reduces = ter.has_flag( ter_furn_flag::TFLAG_REDUCE_SCENT ) ||
+                             here.furn( p ).obj().has_flag( ter_furn_flag::TFLAG_REDUCE_SCENT );
+        CHECK( blocks_scent[p.x][p.y] == blocks );
+        CHECK( reduces_scent[p.x][p.y] == ( !blocks && reduces ) );
+    }
+}
+
+TEST_CASE( "map_cache_rebuild_benchmark", "[.][map][benchmark]" )
+{
+    map &here = get_map();
+    build_cache_test_map();
+    here.build_map_cache( 0 );
+    std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> blocks_scent;
+    std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> reduces_scent;
+
+    BENCHMARK( "floor cache" ) {
+        here.set_floor_cache_dirty( 0 );
+        return here.build_floor_cache( 0 );
+    };
+    BENCHMARK( "transparency cache" ) {
+        // build_transparency_cache is not public, this also updates what depends on it
+        here.set_transparency_cache_dirty( 0 );
+        here.build_map_cache( 0, true );
+    };
+    BENCHMARK( "pathfinding cache" ) {
+        here.set_pathfinding_cache_dirty( 0 );
+        here.update_pathfinding_cache( 0 );
+    };
+    BENCHMARK( "scent blockers" ) {
+        here.scent_blockers( blocks_scent, reduces_scent, point_zero,
+                             point( MAPSIZE_X - 1, MAPSIZE_Y - 1 ) );
+        return blocks_scent[0][0];
+    };
+}
+
+TEST_CASE( "sees_stays_reflexive_when_the_lines_differ", "[map][vision]" )
+{
+    map &here = get_map();
+    clear_map();
+    clear_avatar();
+    const tripoint from( 60, 60, 0 );
+    const tripoint to = from + tripoint( 2, 1, 0 );
+    const tripoint wall = from + tripoint( 1, 0, 0 );
+    // The line from one end passes the wall, the line back does not
+    const std::vector<point> line_there = line_to( from.xy(), to.xy() );
+    const std::vector<point> line_back = line_to( to.xy(), from.xy() );
+    REQUIRE( std::find( line_there.begin(), line_there.end(), wall.xy() ) != line_there.end() );
+    REQUIRE( std::find( line_back.begin(), line_back.end(), wall.xy() ) == line_back.end() );
+    here.ter_set( wall, ter_t_wall );
+    here.build_map_cache( 0 );
+
+    SECTION( "asking from the end the wall blocks first" ) {
+        const bool seen = here.sees( from, to, 20 );
+        CHECK( here.sees( to, from, 20 ) == seen );
+    }
+    SECTION( "asking from the other end first" ) {
+        const bool seen = here.sees( to, from, 20 );
+        CHECK( here.sees( from, to, 20 ) == seen );
+    }
+}
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <vector>
+
+#include "avatar.h"
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "game_constants.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapbuffer.h"
+#include "mapgen_prefetch.h"
+#include "player_helpers.h"
+#include "point.h"
+
+TEST_CASE( "mapgen_prefetch_predicts_terrain_ahead_of_the_bubble", "[mapgen]" )
+{
+    const tripoint_abs_sm origin( 100, 200, 0 );
+    const point_abs_omt lo = project_to<coords::omt>( origin.xy() );
+    const point_abs_omt hi = project_to<coords::omt>( origin.xy() + point( MAPSIZE - 1,
+                             MAPSIZE - 1 ) );
+    const int width = hi.y() - lo.y() + 1;
+
+    CHECK( mapgen_prefetch::predict( origin, point_zero, 2 ).empty() );
+
+    SECTION( "moving east" ) {
+        const std::vector<point_abs_omt> east = mapgen_prefetch::predict( origin, point_east, 2 );
+        CHECK( east.size() == static_cast<size_t>( 2 * width ) );
+        for( const point_abs_omt &p : east ) {
+            CHECK( p.x() > hi.x() );
+            CHECK( p.x() <= hi.x() + 2 );
+            CHECK( p.y() >= lo.y() );
+            CHECK( p.y() <= hi.y() );
+        }
+        // Nearest first
+        CHECK( east.front().x() == hi.x() + 1 );
+        CHECK( east.back().x() == hi.x() + 2 );
+    }
+
+    SECTION( "moving diagonally" ) {
+        const std::vector<point_abs_omt> diagonal =
+            mapgen_prefetch::predict( origin, point_south_west, 1 );
+        for( const point_abs_omt &p : diagonal ) {
+            CHECK( ( p.x() < lo.x() || p.y() > hi.y() ) );
+            CHECK( p.x() <= hi.x() );
+            CHECK( p.y() >= lo.y() );
+        }
+        CHECK( std::count( diagonal.begin(), diagonal.end(),
+                           point_abs_omt( lo.x() - 1, hi.y() + 1 ) ) == 1 );
+    }
+}
+
+TEST_CASE( "mapgen_prefetch_spreads_generation_over_turns", "[mapgen]" )
+{
+    clear_map();
+    clear_avatar();
+    avatar &u = get_avatar();
+    const tripoint start = u.pos();
+    // Remembers where the player is
+    mapgen_prefetch::update( 1 );
+    u.setpos( start + tripoint_east );
+    const std::vector<point_abs_omt> ahead =
+        mapgen_prefetch::predict( get_map().get_abs_sub(), point_east, 1 );
+    REQUIRE( !ahead.empty() );
+
+    // Standing still from here on, whatever is left is generated on the following turns
+    const int most = static_cast<int>( ahead.size() ) * OVERMAP_LAYERS;
+    int turns = 0;
+    int generated = 0;
+    do {
+        generated = mapgen_prefetch::update( 1 );
+        CHECK( generated <= 1 );
+    } while( generated > 0 && ++turns <= most );
+    CHECK( turns <= most );
+    for( const point_abs_omt &p : ahead ) {
+        const tripoint_abs_omt omt( p, u.posz() );
+        CAPTURE( omt.to_string() );
+        CHECK( MAPBUFFER.lookup_submap( project_to<coords::sm>( omt ) ) != nullptr );
+    }
+
+    u.setpos( start );
+    mapgen_prefetch::update( 0 );
+}
@@ -0,0 +1,72 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cata_catch.h"
+#include "map.h"
+#include "map_iterator.h"
+#include "mapdata.h"
+#include "mapgen.h"
+#include "mapgen_functions.h"
+#include "mapgendata.h"
+#include "point.h"
+#include "rng.h"
+#include "type_id.h"
+
+namespace
+{
+// Terrain and furniture of every tile after running the mapgen on a fresh map
+std::vector<std::pair<ter_id, furn_id>> generate( const std::string &mapgen_id,
+                                                bool static_layers )
+{
+    jmapgen_objects::use_static_layers = static_layers;
+    rng_set_engine_seed( 4242 );
+    fake_map tmp_map;
+    mapgendata md( tmp_map, mapgendata::dummy_settings );
+    run_mapgen_func( mapgen_id, md );
+    jmapgen_objects::use_static_layers = true;
+
+    std::vector<std::pair<ter_id, furn_id>> result;
+    for( const tripoint &p : tmp_map.points_on_zlevel( fake_map::fake_map_z ) ) {
+        result.emplace_back( tmp_map.ter( p ), tmp_map.furn( p ) );
+    }
+    return result;
+}
+
+const std::vector<std::string> mapgen_ids = {
+    "cemetery_small", "gym_fitness", "gym_fitness_roof", "house_01"
+};
+} // namespace
+
+TEST_CASE( "mapgen_static_layers_do_not_change_the_result", "[mapgen]" )
+{
+    for( const std::string &id : mapgen_ids ) {
+        CAPTURE( id );
+        const std::vector<std::pair<ter_id, furn_id>> with_layers = generate( id, true );
+        const std::vector<std::pair<ter_id, furn_id>> without_layers = generate( id, false );
+        REQUIRE( with_layers.size() == without_layers.size() );
+        for( size_t i = 0; i < with_layers.size(); i++ ) {
+            CAPTURE( i );
+            CHECK( with_layers[i].first == without_layers[i].first );
+            CHECK( with_layers[i].second == without_layers[i].second );
+        }
+    }
+}
+
+TEST_CASE( "mapgen_static_layers_benchmark", "[.][mapgen][benchmark]" )
+{
+    BENCHMARK( "with static layers" ) {
+        size_t tiles = 0;
+        for( const std::string &id : mapgen_ids ) {
+            tiles += generate( id, true ).size();
+        }
+        return tiles;
+    };
+    BENCHMARK( "without static layers" ) {
+        size_t tiles = 0;
+        for( const std::string &id : mapgen_ids ) {
+            tiles += generate( id, false ).size();
+        }
+        return tiles;
+    };
+}
@@ -167,3 +167,14 @@ TEST_CASE( "monfaction_extend", "[monster][monfactions]" )
     CHECK( orig.attitude( monfaction_test_monfaction5 ) == MFA_BY_MOOD );
     CHECK( extn.attitude( monfaction_test_monfaction5 ) == MFA_BY_MOOD );
 }
+
+TEST_CASE( "monfactions_attitude_matrix_matches_factions", "[monster][monfactions]" )
+{
+    for( const monfaction &f : monfactions::get_all() ) {
+        CAPTURE( f.id.str() );
+        for( const monfaction &f1 : monfactions::get_all() ) {
+            CAPTURE( f1.id.str() );
+            CHECK( monfactions::attitude( f.id, f1.id ) == f.attitude( f1.id ) );
+        }
+    }
+}
@@ -4,6 +4,7 @@
 #include "item.h"
 #include "map.h"
 #include "point.h"
+#include "temperature_history.h"
 #include "type_id.h"
 #include "weather.h"
 
@@ -133,3 +134,29 @@ TEST_CASE( "Hourly_rotpoints", "[rot]" )
     CHECK( normal_item.calc_hourly_rotpoints_at_temp( units::from_fahrenheit( 107 ) ) == Approx(
                20364.67 ) );
 }
+
+TEST_CASE( "Rot_catch_up_with_shared_temperature_history", "[rot]" )
+{
+    // Items catching up on a long absence from the reality bubble should rot the same
+    // whether or not they share a temperature history.
+    if( calendar::turn <= calendar::start_of_cataclysm ) {
+        calendar::turn = calendar::start_of_cataclysm + 1_minutes;
+    }
+
+    item direct_item( "apple" );
+    item shared_item( "apple" );
+    direct_item.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::NORMAL );
+    shared_item.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::NORMAL );
+
+    calendar::turn += 5_days;
+
+    direct_item.process_temperature_rot( 1, tripoint_zero, get_map(), nullptr );
+    {
+        scoped_temperature_history_cache history_cache;
+        shared_item.process_temperature_rot( 1, tripoint_zero, get_map(), nullptr );
+    }
+
+    REQUIRE( to_turns<int>( direct_item.get_rot() ) > 0 );
+    CHECK( to_turns<int>( shared_item.get_rot() )
+           == Approx( to_turns<int>( direct_item.get_rot() ) ).epsilon( 0.02 ) );
+}
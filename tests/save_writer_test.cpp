@@ -0,0 +1,42 @@
+#include <optional>
+#include <ostream>
+#include <string>
+
+#include "cata_catch.h"
+#include "cata_utility.h"
+#include "filesystem.h"
+#include "path_info.h"
+#include "save_writer.h"
+
+TEST_CASE( "save_writer_writes_the_last_queued_contents", "[save]" )
+{
+    const std::string dir = PATH_INFO::user_dir() + "save_writer_test/";
+    REQUIRE( assure_dir_exist( dir ) );
+
+    for( int i = 0; i < 20; i++ ) {
+        save_writer::write_to_file( dir + std::to_string( i ) + ".txt", [i]( std::ostream & fout ) {
+            fout << "first " << i;
+        } );
+    }
+    // Replaces the queued files, or follows them if they are being written already
+    for( int i = 0; i < 20; i += 2 ) {
+        save_writer::write_to_file( dir + std::to_string( i ) + ".txt", [i]( std::ostream & fout ) {
+            fout << "second " << i;
+        } );
+    }
+    // Reading waits for the queued files
+    const std::optional<std::string> last = read_whole_file( dir + "18.txt" );
+    REQUIRE( last );
+    CHECK( *last == "second 18" );
+
+    CHECK( save_writer::wait() );
+    for( int i = 0; i < 20; i++ ) {
+        CAPTURE( i );
+        const std::optional<std::string> contents =
+            read_whole_file( dir + std::to_string( i ) + ".txt" );
+        REQUIRE( contents );
+        CHECK( *contents == ( i % 2 == 0 ? "second " : "first " ) + std::to_string( i ) );
+        CHECK( remove_file( dir + std::to_string( i ) + ".txt" ) );
+    }
+    CHECK( remove_directory( dir ) );
+}
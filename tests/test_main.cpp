@@ -4,15 +4,20 @@
 #endif
 #define CATCH_CONFIG_RUNNER
 #include <algorithm>
+#include <cerrno>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <exception>
+#include <iostream>
 #include <memory>
+#include <optional>
 #include <ostream>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -20,6 +25,8 @@
 #include "cata_catch.h"
 #include "coordinates.h"
 #ifndef _WIN32
+#include <fcntl.h>
+#include <sys/wait.h>
 #include <unistd.h>
 #endif
 
@@ -42,7 +49,10 @@
 #include "overmap.h"
 #include "overmapbuffer.h"
 #include "path_info.h"
+#include "ret_val.h"
 #include "rng.h"
+#include "save_writer.h"
+#include "try_parse_integer.h"
 #include "type_id.h"
 #include "weather.h"
 #include "worldfactory.h"
@@ -85,6 +95,40 @@ static std::vector<mod_id> extract_mod_selection( std::vector<const char *> &arg
     return ret;
 }
 
+static void make_test_world( const std::vector<mod_id> &mods )
+{
+    // Using unicode characters in the world name to test path encoding
+#ifndef _WIN32
+    const std::string test_world_name = "Test World 测试世界 " + std::to_string( getpid() );
+#else
+    const std::string test_world_name = "Test World 测试世界";
+#endif
+    WORLD *test_world = world_generator->make_new_world( test_world_name, mods );
+    cata_assert( test_world != nullptr );
+    world_generator->set_active_world( test_world );
+    cata_assert( world_generator->active_world != nullptr );
+}
+
+// Deletes the test world, or saves it for inspection if tests failed.
+// Returns false if saving failed.
+static bool clean_up_test_world( const bool tests_failed, const bool dont_save )
+{
+    std::string world_name = world_generator->active_world->world_name;
+    if( !tests_failed || dont_save ) {
+        // Files the tests queued must not land in the world after it is deleted
+        save_writer::wait();
+        world_generator->delete_world( world_name, true );
+    } else {
+        if( g->save() ) {
+            DebugLog( D_INFO, DC_ALL ) << "Test world " << world_name << " left for inspection.";
+        } else {
+            DebugLog( D_ERROR, DC_ALL ) << "Test world " << world_name << " failed to save.";
+            return false;
+        }
+    }
+    return true;
+}
+
 static void init_global_game_state( const std::vector<mod_id> &mods,
                                     option_overrides_t &option_overrides,
                                     const std::string &user_dir )
@@ -135,16 +179,7 @@ static void init_global_game_state( const std::vector<mod_id> &mods,
 
     world_generator->set_active_world( nullptr );
     world_generator->init();
-    // Using unicode characters in the world name to test path encoding
-#ifndef _WIN32
-    const std::string test_world_name = "Test World 测试世界 " + std::to_string( getpid() );
-#else
-    const std::string test_world_name = "Test World 测试世界";
-#endif
-    WORLD *test_world = world_generator->make_new_world( test_world_name, mods );
-    cata_assert( test_world != nullptr );
-    world_generator->set_active_world( test_world );
-    cata_assert( world_generator->active_world != nullptr );
+    make_test_world( mods );
 
     calendar::set_eternal_season( get_option<bool>( "ETERNAL_SEASON" ) );
     calendar::set_season_length( get_option<int>( "SEASON_LENGTH" ) );
@@ -239,9 +274,17 @@ static std::string extract_user_dir( std::vector<const char *> &arg_vec )
     return option_user_dir;
 }
 
+// Totals of the last run of the session, for the test workers to report back
+static Catch::Totals last_run_totals;
+
 struct CataListener : Catch::TestEventListenerBase {
     using TestEventListenerBase::TestEventListenerBase;
 
+    void testRunEnded( Catch::TestRunStats const &testRunStats ) override {
+        TestEventListenerBase::testRunEnded( testRunStats );
+        last_run_totals = testRunStats.totals;
+    }
+
     void sectionStarting( Catch::SectionInfo const &sectionInfo ) override {
         TestEventListenerBase::sectionStarting( sectionInfo );
         // Initialize the cata RNG with the Catch seed for reproducible tests
@@ -289,6 +332,169 @@ struct CataListener : Catch::TestEventListenerBase {
 
 CATCH_REGISTER_LISTENER( CataListener )
 
+#ifndef _WIN32
+// A test spec matching only the test case with this name
+static std::string test_spec_for_name( const std::string &name )
+{
+    std::string spec;
+    for( const char c : name ) {
+        if( c == '\\' || c == ',' || c == '[' || c == ']' || c == '"' || c == '~' || c == '*' ) {
+            spec += '\\';
+        }
+        spec += c;
+    }
+    return spec;
+}
+
+// The report file given with -o for one worker, so the workers do not overwrite each other's
+// reports: "report.xml" becomes "report.worker_1.xml".  Streams, like %debug, are kept.
+static std::string worker_output_filename( const std::string &filename, const size_t worker )
+{
+    if( filename.empty() || filename[0] == '%' ) {
+        return filename;
+    }
+    const std::string suffix = ".worker_" + std::to_string( worker + 1 );
+    const size_t dir_end = filename.find_last_of( "/\\" );
+    const size_t ext = filename.rfind( '.' );
+    if( ext == std::string::npos || ext == 0 ||
+        ( dir_end != std::string::npos && ext <= dir_end + 1 ) ) {
+        return filename + suffix;
+    }
+    return filename.substr( 0, ext ) + suffix + filename.substr( ext );
+}
+
+static void write_counts( std::ostream &out, const Catch::Counts &counts )
+{
+    out << counts.passed << ' ' << counts.failed << ' ' << counts.failedButOk << '\n';
+}
+
+static void read_counts( std::istream &in, Catch::Counts &counts )
+{
+    in >> counts.passed >> counts.failed >> counts.failedButOk;
+}
+
+static void print_counts( const char *what, const Catch::Counts &counts )
+{
+    printf( "%s: %zu | %zu passed | %zu failed", what, counts.total(), counts.passed,
+            counts.failed );
+    if( counts.failedButOk != 0 ) {
+        printf( " | %zu failed as expected", counts.failedButOk );
+    }
+    printf( "\n" );
+}
+
+// Runs the test cases selected for the session in jobs processes forked from this one, so they
+// share the game data loaded already.  Test cases are dealt to the workers in order, and every
+// test still seeds the RNG from the session seed, so a worker runs its tests the same way each
+// time.  Each worker has a world of its own and writes its output to a log, the logs are printed
+// in order once all workers are done, followed by the test case and assertion counts of all of
+// them.  A report file given with -o is split into one per worker.
+// Returns the number of workers that failed.
+static int run_in_workers( Catch::Session &session, const std::vector<mod_id> &mods,
+                           const int jobs, const bool dont_save, const std::string &user_dir )
+{
+    const Catch::Config &config = session.config();
+    const std::vector<Catch::TestCase> tests =
+        Catch::filterTests( Catch::getAllTestCasesSorted( config ), config.testSpec(), config );
+    std::vector<std::string> specs( std::min<size_t>( jobs, tests.size() ) );
+    std::vector<size_t> test_counts( specs.size() );
+    for( size_t i = 0; i < tests.size(); i++ ) {
+        std::string &spec = specs[i % specs.size()];
+        if( !spec.empty() ) {
+            spec += ',';
+        }
+        spec += test_spec_for_name( tests[i].name );
+        test_counts[i % specs.size()]++;
+    }
+
+    std::vector<pid_t> workers;
+    for( size_t w = 0; w < specs.size(); w++ ) {
+        const std::string log = user_dir + "test_worker_" + std::to_string( w ) + ".log";
+        const std::string totals = user_dir + "test_worker_" + std::to_string( w ) + ".totals";
+        fflush( stdout );
+        fflush( stderr );
+        const pid_t pid = fork();
+        if( pid < 0 ) {
+            cata_fatal( "Unable to start test worker: %s", strerror( errno ) );
+        }
+        if( pid > 0 ) {
+            workers.push_back( pid );
+            continue;
+        }
+
+        const int fd = open( log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+        if( fd >= 0 ) {
+            dup2( fd, STDOUT_FILENO );
+            dup2( fd, STDERR_FILENO );
+            close( fd );
+        }
+        make_test_world( mods );
+        Catch::ConfigData data = session.configData();
+        data.testsOrTags = { specs[w] };
+        data.outputFilename = worker_output_filename( data.outputFilename, w );
+        session.useConfigData( data );
+        int result = session.run();
+        write_to_file( totals, []( std::ostream & fout ) {
+            fout << last_run_totals.error << '\n';
+            write_counts( fout, last_run_totals.testCases );
+            write_counts( fout, last_run_totals.assertions );
+        }, nullptr );
+        if( debug_has_error_been_observed() ) {
+            DebugLog( D_INFO, DC_ALL ) << "Treating result as failure due to error logged.";
+            result = std::max( result, 1 );
+        }
+        if( !clean_up_test_world( result != 0, dont_save ) ) {
+            result = std::max( result, 1 );
+        }
+        std::cout.flush();
+        std::cerr.flush();
+        fflush( stdout );
+        fflush( stderr );
+        // Skip the destructors of the data shared with the parent
+        _exit( std::min( result, 255 ) );
+    }
+
+    int failed = 0;
+    Catch::Totals all_totals;
+    for( size_t w = 0; w < workers.size(); w++ ) {
+        int status = 0;
+        waitpid( workers[w], &status, 0 );
+        const std::string log = user_dir + "test_worker_" + std::to_string( w ) + ".log";
+        const std::string totals = user_dir + "test_worker_" + std::to_string( w ) + ".totals";
+        printf( "===== Test worker %zu of %zu, %zu test cases =====\n", w + 1, workers.size(),
+                test_counts[w] );
+        const std::optional<std::string> output = read_whole_file( log );
+        if( output ) {
+            fwrite( output->data(), 1, output->size(), stdout );
+            remove_file( log );
+        }
+        if( const std::optional<std::string> worker_totals = read_whole_file( totals ) ) {
+            std::istringstream in( *worker_totals );
+            Catch::Totals t;
+            in >> t.error;
+            read_counts( in, t.testCases );
+            read_counts( in, t.assertions );
+            all_totals += t;
+            remove_file( totals );
+        } else {
+            printf( "Test worker %zu did not report its results\n", w + 1 );
+        }
+        if( WIFEXITED( status ) && WEXITSTATUS( status ) == 0 ) {
+            continue;
+        }
+        failed++;
+        if( WIFSIGNALED( status ) ) {
+            printf( "Test worker %zu was killed by signal %d\n", w + 1, WTERMSIG( status ) );
+        }
+    }
+    printf( "===== All %zu test workers =====\n", workers.size() );
+    print_counts( "test cases", all_totals.testCases );
+    print_counts( "assertions", all_totals.assertions );
+    printf( "%d of %zu test workers failed\n", failed, workers.size() );
+    return failed;
+}
+#endif
+
 int main( int argc, const char *argv[] )
 {
     reset_floating_point_mode();
@@ -311,6 +517,18 @@ int main( int argc, const char *argv[] )
 
     std::string user_dir = extract_user_dir( arg_vec );
 
+    int jobs = 1;
+    const std::string jobs_str = extract_argument( arg_vec, "--jobs=" );
+    if( !jobs_str.empty() ) {
+        ret_val<int> parsed = try_parse_integer<int>( jobs_str, false );
+        if( !parsed.success() || parsed.value() < 0 ) {
+            printf( "Invalid number of jobs %s", jobs_str.c_str() );
+            return EXIT_FAILURE;
+        }
+        jobs = parsed.value() == 0 ? static_cast<int>( std::thread::hardware_concurrency() ) :
+               parsed.value();
+    }
+
     std::string error_fmt = extract_argument( arg_vec, "--error-format=" );
     if( error_fmt == "github-action" ) {
         // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
@@ -350,9 +568,24 @@ int main( int argc, const char *argv[] )
         printf( "  --error-format=<value>       Format of error messages.  Possible values are:\n" );
         printf( "                                   human-readable (default)\n" );
         printf( "                                   github-action\n" );
+        printf( "  --jobs=<n>                   Run tests in n processes forked after loading\n" );
+        printf( "                               data, 0 for one per core.  Their output is\n" );
+        printf( "                               printed once all of them are done.  A report\n" );
+        printf( "                               file given with -o gets one per worker.\n" );
         return result;
     }
 
+    if( session.config().listTests() || session.config().listTestNamesOnly() ||
+        session.config().listTags() || session.config().listReporters() ) {
+        jobs = 1;
+    }
+#ifdef _WIN32
+    if( jobs > 1 ) {
+        printf( "--jobs is not supported on this platform, running the tests in one process.\n" );
+        jobs = 1;
+    }
+#endif
+
     // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
     test_mode = true;
 
@@ -386,19 +619,20 @@ int main( int argc, const char *argv[] )
 
     DebugLog( D_INFO, DC_ALL ) << "Game data loaded, running Catch2 session:" << std::endl;
     const std::chrono::system_clock::time_point start = std::chrono::system_clock::now();
+#ifndef _WIN32
+    if( jobs > 1 ) {
+        result = run_in_workers( session, mods, jobs, dont_save, user_dir );
+    } else {
+        result = session.run();
+    }
+#else
     result = session.run();
+#endif
     const std::chrono::system_clock::time_point end = std::chrono::system_clock::now();
 
-    std::string world_name = world_generator->active_world->world_name;
-    if( result == 0 || dont_save ) {
-        world_generator->delete_world( world_name, true );
-    } else {
-        if( g->save() ) {
-            DebugLog( D_INFO, DC_ALL ) << "Test world " << world_name << " left for inspection.";
-        } else {
-            DebugLog( D_ERROR, DC_ALL ) << "Test world " << world_name << " failed to save.";
-            result = 1;
-        }
+    // The workers keep worlds of their own
+    if( !clean_up_test_world( result != 0 && jobs <= 1, dont_save ) ) {
+        result = 1;
     }
 
     std::chrono::duration<double> elapsed_seconds = end - start;
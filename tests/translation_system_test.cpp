@@ -67,6 +67,28 @@ TEST_CASE( "No_string_buffer_overlap_in_TranslationDocument", "[translations]" )
     }
 }
 
+TEST_CASE( "TranslationDocument_finds_every_string", "[translations]" )
+{
+    std::vector<std::string> paths{"./data/mods/TEST_DATA/lang/mo/ru/LC_MESSAGES/TEST_DATA.mo"};
+    for( const std::string &lang : TranslationManager::GetInstance().GetAvailableLanguages() ) {
+        paths.emplace_back( string_format( "./lang/mo/%s/LC_MESSAGES/cataclysm-dda.mo", lang ) );
+    }
+    for( const std::string &path : paths ) {
+        CAPTURE( path );
+        REQUIRE( file_exist( path ) );
+        TranslationDocument document( path );
+        CHECK_FALSE( document.Find( "" ) );
+        CHECK_FALSE( document.Find( "__UnTrAnSlAtEd!!!__#" ) );
+        for( std::size_t i = 1; i < document.Count(); i++ ) {
+            const char *original = document.GetOriginalString( i );
+            CAPTURE( original );
+            const std::optional<std::size_t> found = document.Find( original );
+            REQUIRE( found );
+            CHECK( strcmp( document.GetOriginalString( *found ), original ) == 0 );
+        }
+    }
+}
+
 TEST_CASE( "TranslationDocument_loading_benchmark", "[.][benchmark][translations]" )
 {
     BENCHMARK( "Load Russian" ) {
@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "cata_catch.h"
+#include "cata_utility.h"
+#include "trigram_index.h"
+
+TEST_CASE( "trigram_index_candidates_include_every_lcmatch", "[trigram_index]" )
+{
+    const std::vector<std::string> texts = {
+        "Steel Frame", "steel chunk", "Café au lait", "Öltank", "hammer", "sledge hammer",
+        "ПАЛКА", "wood"
+    };
+    trigram_index index;
+    for( size_t i = 0; i < texts.size(); i++ ) {
+        index.add( static_cast<trigram_index::doc_id>( i ), texts[i] );
+    }
+    index.finalize();
+
+    for( const std::string query : {
+             "steel", "STEEL F", "cafe", "café", "oltank", "hammer", "палк", "el c", "xyz"
+         } ) {
+        CAPTURE( query );
+        const std::optional<std::vector<trigram_index::doc_id>> candidates =
+            index.candidates( query );
+        REQUIRE( candidates );
+        for( size_t i = 0; i < texts.size(); i++ ) {
+            CAPTURE( texts[i] );
+            const trigram_index::doc_id doc = static_cast<trigram_index::doc_id>( i );
+            const bool is_candidate =
+                std::find( candidates->begin(), candidates->end(), doc ) != candidates->end();
+            if( lcmatch( texts[i], query ) ) {
+                CHECK( is_candidate );
+            }
+        }
+    }
+
+    CHECK( index.candidates( "hammer" )->size() == 2 );
+    CHECK( index.candidates( "xyz" )->empty() );
+    // Too short to narrow anything down
+    CHECK_FALSE( index.candidates( "st" ) );
+    CHECK_FALSE( index.candidates( "" ) );
+}
@@ -0,0 +1,99 @@
+#include <cstddef>
+#include <vector>
+
+#include "cata_catch.h"
+#include "game_constants.h"
+#include "lru_cache.h"
+#include "point.h"
+#include "vision_pair_cache.h"
+
+TEST_CASE( "vision_pair_cache_keeps_pairs_in_either_order", "[map][vision]" )
+{
+    vision_pair_cache cache;
+    const tripoint a( 10, 20, 0 );
+    const tripoint b( 30, 5, 0 );
+    const tripoint c( 30, 5, -1 );
+    CHECK( cache.get( a, b ) == -1 );
+
+    cache.insert( a, b, true );
+    cache.insert( c, a, false );
+    CHECK( cache.get( a, b ) == 1 );
+    CHECK( cache.get( b, a ) == 1 );
+    CHECK( cache.get( a, c ) == 0 );
+    CHECK( cache.get( b, c ) == -1 );
+    CHECK( cache.size() == 2 );
+
+    cache.insert( b, a, false );
+    CHECK( cache.get( a, b ) == 0 );
+    CHECK( cache.size() == 2 );
+
+    cache.clear();
+    CHECK( cache.get( a, b ) == -1 );
+    CHECK( cache.size() == 0 );
+}
+
+TEST_CASE( "vision_pair_cache_is_cleared_when_full", "[map][vision]" )
+{
+    vision_pair_cache cache;
+    const tripoint from( 0, 0, 0 );
+    size_t inserted = 0;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT && inserted <= vision_pair_cache::max_size;
+         z++ ) {
+        for( int y = 0; y < MAPSIZE_Y && inserted <= vision_pair_cache::max_size; y++ ) {
+            for( int x = 0; x < MAPSIZE_X && inserted <= vision_pair_cache::max_size; x++ ) {
+                cache.insert( from, tripoint( x, y, z ), true );
+                inserted++;
+                REQUIRE( cache.size() <= vision_pair_cache::max_size );
+            }
+        }
+    }
+    CHECK( cache.size() == 1 );
+}
+
+// The same mix of queries against the pair LRU map::sees used before, with its key packing
+TEST_CASE( "vision_pair_cache_benchmark", "[.][map][vision][benchmark]" )
+{
+    std::vector<tripoint> observers;
+    for( int x = 30; x < 100; x += 5 ) {
+        for( int y = 30; y < 100; y += 5 ) {
+            observers.emplace_back( x, y, 0 );
+        }
+    }
+    const auto pack = []( const tripoint & p ) {
+        return p.x << 16 | p.y << 8 | ( p.z + OVERMAP_DEPTH );
+    };
+
+    BENCHMARK( "lru_cache<point, char>" ) {
+        lru_cache<point, char> cache;
+        int seen = 0;
+        for( const tripoint &from : observers ) {
+            for( const tripoint &to : observers ) {
+                const tripoint &min = from < to ? from : to;
+                const tripoint &max = !( from < to ) ? from : to;
+                const point key( pack( min ), pack( max ) );
+                char cached = cache.get( key, -1 );
+                if( cached < 0 ) {
+                    cached = ( from.x + to.y ) % 3 != 0;
+                    cache.insert( 100000, key, cached );
+                }
+                seen += cached;
+            }
+        }
+        return seen;
+    };
+    BENCHMARK( "vision_pair_cache" ) {
+        vision_pair_cache cache;
+        int seen = 0;
+        for( const tripoint &from : observers ) {
+            for( const tripoint &to : observers ) {
+                int cached = cache.get( from, to );
+                if( cached < 0 ) {
+                    cached = ( from.x + to.y ) % 3 != 0;
+                    cache.insert( from, to, cached > 0 );
+                }
+                seen += cached;
+            }
+        }
+        return seen;
+    };
+}
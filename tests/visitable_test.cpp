@@ -1,14 +1,28 @@
 #include "cata_catch.h"
 
+#include <climits>
+#include <utility>
+#include <vector>
+
+#include "avatar.h"
 #include "calendar.h"
+#include "character.h"
 #include "inventory.h"
 #include "item.h"
 #include "item_pocket.h"
+#include "npc.h"
+#include "player_helpers.h"
 #include "ret_val.h"
 #include "type_id.h"
 
+static const itype_id itype_any( "any" );
+static const itype_id itype_battery( "battery" );
+static const itype_id itype_hammer( "hammer" );
 static const itype_id itype_water( "water" );
 
+static const quality_id qual_BOIL( "BOIL" );
+static const quality_id qual_HAMMER( "HAMMER" );
+
 TEST_CASE( "visitable_summation" )
 {
     inventory test_inv;
@@ -24,3 +38,82 @@ TEST_CASE( "visitable_summation" )
 
     CHECK( test_inv.charges_of( itype_water, item::INFINITE_CHARGES ) > 1 );
 }
+
+TEST_CASE( "item_index_answers_like_visiting_the_items", "[visitable][inventory]" )
+{
+    clear_avatar();
+    avatar &u = get_avatar();
+    u.wear_item( item( "backpack" ) );
+    u.i_add( item( "hammer" ) );
+
+    item bottle_of_water( "bottle_plastic" );
+    item water_in_bottle( "water" );
+    water_in_bottle.charges = bottle_of_water.get_remaining_capacity_for_liquid( water_in_bottle );
+    bottle_of_water.put_in( water_in_bottle, item_pocket::pocket_type::CONTAINER );
+    u.i_add( bottle_of_water );
+
+    item flashlight( "flashlight" );
+    item cell( "light_battery_cell" );
+    cell.ammo_set( cell.ammo_default(), 20 );
+    flashlight.put_in( cell, item_pocket::pocket_type::MAGAZINE_WELL );
+    u.i_add( flashlight );
+
+    const auto ask = [&u]() {
+        return std::vector<int> {
+            u.amount_of( itype_hammer ),
+            u.amount_of( itype_any ),
+            u.amount_of( itype_any, true, 2 ),
+            u.charges_of( itype_water ),
+            u.charges_of( itype_water, 1 ),
+            u.charges_of( itype_battery ),
+            u.charges_of( itype_battery, INT_MAX, return_true<item>, nullptr, true ),
+            u.has_quality( qual_HAMMER ) ? 1 : 0,
+            u.has_quality( qual_HAMMER, 1, 2 ) ? 1 : 0,
+            u.max_quality( qual_HAMMER ),
+            u.max_quality( qual_BOIL )
+        };
+    };
+    const std::vector<int> visited = ask();
+    REQUIRE( visited[0] == 1 );
+    REQUIRE( visited[3] > 1 );
+    REQUIRE( visited[6] == 20 );
+
+    {
+        Character::item_index_scope scope( u );
+        CHECK( ask() == visited );
+        // Adding items drops the index
+        u.i_add( item( "hammer" ) );
+        CHECK( u.amount_of( itype_hammer ) == 2 );
+        CHECK( u.has_quality( qual_HAMMER, 1, 2 ) );
+    }
+    CHECK( u.amount_of( itype_hammer ) == 2 );
+}
+
+TEST_CASE( "item_index_stays_with_the_character_object", "[visitable][inventory]" )
+{
+    standard_npc from( "From" );
+    from.i_add( item( "hammer" ) );
+    Character::item_index_scope from_scope( from );
+    REQUIRE( from.amount_of( itype_hammer ) == 1 );
+    REQUIRE( from.get_item_index() != nullptr );
+
+    SECTION( "moving into a new character" ) {
+        npc to( std::move( from ) );
+        // No scope was opened on it
+        CHECK( to.get_item_index() == nullptr );
+        CHECK( to.amount_of( itype_hammer ) == 1 );
+    }
+
+    SECTION( "moving into a character with a scope open" ) {
+        standard_npc to( "To" );
+        {
+            Character::item_index_scope to_scope( to );
+            REQUIRE( to.amount_of( itype_hammer ) == 0 );
+            to = std::move( from );
+            // The index of the old items is gone, the scope still counts
+            CHECK( to.amount_of( itype_hammer ) == 1 );
+            CHECK( to.get_item_index() != nullptr );
+        }
+        CHECK( to.get_item_index() == nullptr );
+    }
+}
@@ -1,5 +1,9 @@
+#include <algorithm>
+#include <vector>
+
 #include "cata_catch.h"
 #include "clzones.h"
+#include "line.h"
 #include "map_helpers.h"
 
 static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
@@ -97,5 +101,38 @@ TEST_CASE( "zones_custom", "[zones]" )
         REQUIRE( nbp2.count( tripoint_abs_ms( zone_testgroup_end ) ) == 0 );
         REQUIRE( nbp2.count( tripoint_abs_ms( zone_groupbatt_end ) ) == 0 );
         REQUIRE( nbp2.count( tripoint_abs_ms( m_zone_loc ) ) == 1 ); // container matches this zone
+
+        // The index used for sorting answers the same
+        loot_zone_index const index( zmgr, where, ACTIVITY_SEARCH_DISTANCE, your_fac );
+        REQUIRE( index.covers( zmgr, where, your_fac ) );
+        for( item const *it : { &hammer, &bow_saw, &pants_fur, &batt, &bag_plastic } ) {
+            CAPTURE( it->tname() );
+            CHECK( index.get_near_zone_type_for_item( *it, where, ACTIVITY_SEARCH_DISTANCE ) ==
+                   zmgr.get_near_zone_type_for_item( *it, where ) );
+            for( zone_type_id const &type : {
+                     zone_type_LOOT_CUSTOM, zone_type_LOOT_ITEM_GROUP
+                 } ) {
+                std::vector<tripoint_abs_ms> const near =
+                    index.get_near( type, where, ACTIVITY_SEARCH_DISTANCE, it );
+                CHECK( pset( near.begin(), near.end() ) ==
+                       zmgr.get_near( type, where, ACTIVITY_SEARCH_DISTANCE, it ) );
+                CHECK( std::is_sorted( near.begin(), near.end(),
+                [&where]( tripoint_abs_ms const & a, tripoint_abs_ms const & b ) {
+                    return square_dist( a, where ) < square_dist( b, where );
+                } ) );
+            }
+            tripoint_abs_ms const loc( zone_loc );
+            CHECK( index.custom_loot_has( loc, *it, zone_type_LOOT_CUSTOM ) ==
+                   zmgr.custom_loot_has( loc, it, zone_type_LOOT_CUSTOM ) );
+        }
+        CHECK( index.has( zone_type_LOOT_CUSTOM, tripoint_abs_ms( zone_hammer_end ) ) );
+        CHECK_FALSE( index.has( zone_type_LOOT_CUSTOM,
+                                tripoint_abs_ms( zone_loc + tripoint( 2, 0, 0 ) ) ) );
+        CHECK( index.has_near( zone_type_LOOT_CUSTOM, where, ACTIVITY_SEARCH_DISTANCE ) );
+        CHECK_FALSE( index.has_near( zone_type_LOOT_CUSTOM, where, 2 ) );
+
+        // Changed zones need a new index
+        mapgen_place_zone( zone_loc, zone_loc, zone_type_LOOT_CUSTOM, your_fac, {}, "hammer" );
+        CHECK_FALSE( index.covers( zmgr, where, your_fac ) );
     }
 }